@@ -1,5 +1,458 @@
 #include "s21_matrix_oop.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cfloat>
+#include <charconv>
+#include <cstring>
+#include <fstream>
+#include <limits>
+
+#if S21_MATRIX_CHECKS == S21_MATRIX_CHECKS_FULL
+#define S21_MATRIX_CHECK(condition, exception, message) \
+    do { \
+        if (!(condition)) throw exception(message); \
+    } while (0)
+#elif S21_MATRIX_CHECKS == S21_MATRIX_CHECKS_DEBUG
+#include <cassert>
+#define S21_MATRIX_CHECK(condition, exception, message) \
+    do { \
+        assert((condition) && message); \
+        static_cast<void>(sizeof(condition)); \
+    } while (0)
+#else
+#define S21_MATRIX_CHECK(condition, exception, message) static_cast<void>(sizeof(condition))
+#endif
+
+namespace {
+
+/**
+ * @brief LU factorization with partial pivoting of a row-major square matrix
+ * 
+ * A pivot not above n * epsilon * ||A||, the rounding error of the
+ * elimination, is taken as zero.
+ * 
+ * @param lu Matrix values, replaced with unit lower L and upper U factors
+ * @param pivots Row swapped with row k on step k
+ * @param n Matrix order
+ * @return True if the matrix is numerically nonsingular in precision T
+ */
+template <typename T>
+bool lu_factorize(T* lu, int* pivots, int n) {
+    T norm = T(0);
+    for (int i = 0; i < n; i++) {
+        T sum = T(0);
+        for (int j = 0; j < n; j++) {
+            sum += std::fabs(lu[i * n + j]);
+        }
+        norm = std::max(norm, sum);
+    }
+    const T tolerance = n * std::numeric_limits<T>::epsilon() * norm;
+    for (int k = 0; k < n; k++) {
+        int pivot = k;
+        for (int i = k + 1; i < n; i++) {
+            if (std::fabs(lu[i * n + k]) > std::fabs(lu[pivot * n + k])) {
+                pivot = i;
+            }
+        }
+        pivots[k] = pivot;
+        if (!(std::fabs(lu[pivot * n + k]) > tolerance)) {
+            return false;
+        }
+        if (pivot != k) {
+            for (int j = 0; j < n; j++) {
+                std::swap(lu[k * n + j], lu[pivot * n + j]);
+            }
+        }
+        const T* rowK = lu + k * n;
+        for (int i = k + 1; i < n; i++) {
+            T* rowI = lu + i * n;
+            const T factor = rowI[k] / rowK[k];
+            rowI[k] = factor;
+            for (int j = k + 1; j < n; j++) {
+                rowI[j] -= factor * rowK[j];
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Solves LU * X = B in place for a row-major n x m right-hand side
+ * 
+ * @param lu Factors from lu_factorize
+ * @param pivots Pivots from lu_factorize
+ * @param n Matrix order
+ * @param x Right-hand side, replaced with the solution
+ * @param m Count of right-hand side columns
+ */
+template <typename T>
+void lu_substitute(const T* lu, const int* pivots, int n, T* x, int m) {
+    for (int k = 0; k < n; k++) {
+        if (pivots[k] != k) {
+            for (int j = 0; j < m; j++) {
+                std::swap(x[k * m + j], x[pivots[k] * m + j]);
+            }
+        }
+    }
+    for (int i = 0; i < n; i++) {
+        T* rowI = x + i * m;
+        for (int k = 0; k < i; k++) {
+            const T factor = lu[i * n + k];
+            const T* rowK = x + k * m;
+            for (int j = 0; j < m; j++) {
+                rowI[j] -= factor * rowK[j];
+            }
+        }
+    }
+    for (int i = n - 1; i >= 0; i--) {
+        T* rowI = x + i * m;
+        for (int k = i + 1; k < n; k++) {
+            const T factor = lu[i * n + k];
+            const T* rowK = x + k * m;
+            for (int j = 0; j < m; j++) {
+                rowI[j] -= factor * rowK[j];
+            }
+        }
+        const T diagonal = lu[i * n + i];
+        for (int j = 0; j < m; j++) {
+            rowI[j] /= diagonal;
+        }
+    }
+}
+
+/**
+ * @brief Infinity norm of a row-major matrix
+ * 
+ * @return Double maximum absolute row sum
+ */
+double norm_inf(const double* values, int rows, int cols) {
+    double result = 0.0;
+    for (int i = 0; i < rows; i++) {
+        double sum = 0.0;
+        for (int j = 0; j < cols; j++) {
+            sum += std::fabs(values[i * cols + j]);
+        }
+        result = std::max(result, sum);
+    }
+    return result;
+}
+
+/**
+ * @brief Computes R = B - A * X for a square A and returns the normwise backward error
+ * 
+ * @param a Row-major n x n matrix
+ * @param x Row-major n x m solution
+ * @param b Row-major n x m right-hand side
+ * @param r Row-major n x m residual output
+ * @return Double ||R|| / (||A|| * ||X||) in the infinity norm
+ */
+double residual_error(const std::vector<double>& a, const std::vector<double>& x,
+                      const std::vector<double>& b, std::vector<double>* r, int n, int m) {
+    *r = b;
+    for (int i = 0; i < n; i++) {
+        double* rowR = r->data() + i * m;
+        for (int k = 0; k < n; k++) {
+            const double factor = a[i * n + k];
+            const double* rowX = x.data() + k * m;
+            for (int j = 0; j < m; j++) {
+                rowR[j] -= factor * rowX[j];
+            }
+        }
+    }
+    const double scale = norm_inf(a.data(), n, n) * norm_inf(x.data(), n, m);
+    const double error = norm_inf(r->data(), n, m);
+    return scale > 0.0 ? error / scale : error;
+}
+
+/**
+ * @brief Element of the Householder vector p of the panel starting at column k0
+ * 
+ * The vectors are stored below the diagonal of the factored matrix with an implicit unit diagonal.
+ */
+inline double householder_element(double** a, int i, int k0, int p) {
+    const int column = k0 + p;
+    return i < column ? 0.0 : (i == column ? 1.0 : a[i][column]);
+}
+
+/**
+ * @brief Forms the upper triangular factor T of the compact WY representation
+ * 
+ * H(k0) * ... * H(k0 + nb - 1) = I - V * T * V^T
+ * 
+ * @param a Factored matrix holding the Householder vectors
+ * @param m Count of rows
+ * @param k0 First column of the panel
+ * @param nb Panel width
+ * @param tau Householder scalars
+ * @return std::vector<double> row-major nb x nb factor T
+ */
+std::vector<double> householder_block_factor(double** a, int m, int k0, int nb, const double* tau) {
+    std::vector<double> gram(nb * nb, 0.0);
+    for (int i = k0; i < m; i++) {
+        const int width = std::min(nb, i - k0 + 1);
+        for (int p = 0; p < width; p++) {
+            const double vp = householder_element(a, i, k0, p);
+            for (int q = p + 1; q < width; q++) {
+                gram[p * nb + q] += vp * householder_element(a, i, k0, q);
+            }
+        }
+    }
+    std::vector<double> t(nb * nb, 0.0);
+    for (int q = 0; q < nb; q++) {
+        for (int p = 0; p < q; p++) {
+            double sum = 0.0;
+            for (int r = p; r < q; r++) {
+                sum += t[p * nb + r] * gram[r * nb + q];
+            }
+            t[p * nb + q] = -tau[q] * sum;
+        }
+        t[q * nb + q] = tau[q];
+    }
+    return t;
+}
+
+/**
+ * @brief Applies the block reflector I - V * T * V^T or its transpose to rows k0..m of C
+ * 
+ * Both updates are matrix products streamed over the rows of V and C.
+ */
+void apply_block_reflector(double** a, int m, int k0, int nb, const std::vector<double>& t,
+                           double** c, int cStart, int cCols, bool transpose) {
+    const int width = cCols - cStart;
+    if (width <= 0) {
+        return;
+    }
+    std::vector<double> w(nb * width, 0.0);
+    for (int i = k0; i < m; i++) {
+        const int count = std::min(nb, i - k0 + 1);
+        const double* rowC = c[i] + cStart;
+        for (int p = 0; p < count; p++) {
+            const double vp = householder_element(a, i, k0, p);
+            double* rowW = w.data() + p * width;
+            for (int j = 0; j < width; j++) {
+                rowW[j] += vp * rowC[j];
+            }
+        }
+    }
+    std::vector<double> tw(nb * width, 0.0);
+    for (int p = 0; p < nb; p++) {
+        double* rowTw = tw.data() + p * width;
+        for (int q = 0; q < nb; q++) {
+            const double factor = transpose ? t[q * nb + p] : t[p * nb + q];
+            if (factor != 0.0) {
+                const double* rowW = w.data() + q * width;
+                for (int j = 0; j < width; j++) {
+                    rowTw[j] += factor * rowW[j];
+                }
+            }
+        }
+    }
+    for (int i = k0; i < m; i++) {
+        const int count = std::min(nb, i - k0 + 1);
+        double* rowC = c[i] + cStart;
+        for (int p = 0; p < count; p++) {
+            const double vp = householder_element(a, i, k0, p);
+            const double* rowTw = tw.data() + p * width;
+            for (int j = 0; j < width; j++) {
+                rowC[j] -= vp * rowTw[j];
+            }
+        }
+    }
+}
+
+/**
+ * @brief Blocked Householder QR factorization of an m x n matrix with m >= n
+ * 
+ * Each panel is factored column by column, the trailing columns are
+ * updated once per panel through the compact WY representation.
+ * 
+ * @param a Matrix values, replaced with R above and Householder vectors below the diagonal
+ * @param m Count of rows
+ * @param n Count of columns
+ * @return std::vector<double> Householder scalars
+ */
+std::vector<double> householder_qr(double** a, int m, int n) {
+    static const int BLOCK_SIZE = 32;
+    std::vector<double> tau(n, 0.0);
+    for (int k0 = 0; k0 < n; k0 += BLOCK_SIZE) {
+        const int nb = std::min(BLOCK_SIZE, n - k0);
+        for (int j = k0; j < k0 + nb; j++) {
+            double norm = 0.0;
+            for (int i = j + 1; i < m; i++) {
+                norm = std::max(norm, std::fabs(a[i][j]));
+            }
+            if (norm > 0.0) {
+                double sum = 0.0;
+                for (int i = j + 1; i < m; i++) {
+                    sum += (a[i][j] / norm) * (a[i][j] / norm);
+                }
+                norm *= std::sqrt(sum);
+            }
+            const double alpha = a[j][j];
+            if (norm == 0.0) {
+                continue;
+            }
+            const double beta = -std::copysign(std::hypot(alpha, norm), alpha);
+            tau[j] = (beta - alpha) / beta;
+            const double scale = 1.0 / (alpha - beta);
+            for (int i = j + 1; i < m; i++) {
+                a[i][j] *= scale;
+            }
+            a[j][j] = beta;
+
+            const int width = k0 + nb - j - 1;
+            std::vector<double> w(a[j] + j + 1, a[j] + j + 1 + width);
+            for (int i = j + 1; i < m; i++) {
+                const double vi = a[i][j];
+                for (int c = 0; c < width; c++) {
+                    w[c] += vi * a[i][j + 1 + c];
+                }
+            }
+            for (int c = 0; c < width; c++) {
+                a[j][j + 1 + c] -= tau[j] * w[c];
+            }
+            for (int i = j + 1; i < m; i++) {
+                const double vi = tau[j] * a[i][j];
+                for (int c = 0; c < width; c++) {
+                    a[i][j + 1 + c] -= vi * w[c];
+                }
+            }
+        }
+        if (k0 + nb < n) {
+            const std::vector<double> t(householder_block_factor(a, m, k0, nb, tau.data() + k0));
+            apply_block_reflector(a, m, k0, nb, t, a, k0 + nb, n, true);
+        }
+    }
+    return tau;
+}
+
+/**
+ * @brief Multiplies C by Q^T or by Q from a Householder QR factorization
+ */
+void apply_householder_q(double** a, int m, int n, const std::vector<double>& tau,
+                         double** c, int cCols, bool transpose) {
+    static const int BLOCK_SIZE = 32;
+    const int blocks = (n + BLOCK_SIZE - 1) / BLOCK_SIZE;
+    for (int b = 0; b < blocks; b++) {
+        const int k0 = (transpose ? b : blocks - 1 - b) * BLOCK_SIZE;
+        const int nb = std::min(BLOCK_SIZE, n - k0);
+        const std::vector<double> t(householder_block_factor(a, m, k0, nb, tau.data() + k0));
+        apply_block_reflector(a, m, k0, nb, t, c, 0, cCols, transpose);
+    }
+}
+
+/**
+ * @brief Skips spaces, tabs and carriage returns except an explicit delimiter
+ * 
+ * @param delimiter Field delimiter, ' ' for any whitespace
+ * @return const char* first other character or end
+ */
+inline const char* skip_blanks(const char* begin, const char* end, char delimiter) {
+    while (begin < end && (*begin == ' ' || *begin == '\t' || *begin == '\r')
+           && (delimiter == ' ' || *begin != delimiter)) {
+        begin++;
+    }
+    return begin;
+}
+
+/**
+ * @brief Parses one line of delimited numbers
+ * 
+ * @param begin Line begin
+ * @param end Line end without the line feed
+ * @param delimiter Field delimiter, ' ' for any whitespace
+ * @param row Output values, at most cols are written
+ * @param cols Count of values to write
+ * @return Int count of fields in the line or -1 if the line is malformed
+ */
+int parse_text_row(const char* begin, const char* end, char delimiter, double* row, int cols) {
+    int count = 0;
+    const char* current = skip_blanks(begin, end, delimiter);
+    while (current < end) {
+        double value = 0.0;
+        const std::from_chars_result result = std::from_chars(current, end, value);
+        if (result.ec != std::errc()) {
+            return -1;
+        }
+        if (count < cols) {
+            row[count] = value;
+        }
+        count++;
+        current = skip_blanks(result.ptr, end, delimiter);
+        if (current == end) {
+            break;
+        } else if (delimiter == ' ') {
+            if (current == result.ptr) {
+                return -1;
+            }
+        } else if (*current != delimiter) {
+            return -1;
+        } else {
+            current = skip_blanks(current + 1, end, delimiter);
+            if (current == end) {
+                return -1;
+            }
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief Parses text lines into newly allocated rows, splitting the lines between threads
+ * 
+ * The rows are allocated before the threads start, so the workers can't throw.
+ * 
+ * @param lines Begin and end of every non-empty line
+ * @param delimiter Field delimiter, ' ' for any whitespace
+ * @param cols Expected count of fields per line
+ * @param rows Output rows, one per line is appended
+ */
+void parse_text_rows(const std::vector<std::pair<const char*, const char*>>& lines, char delimiter,
+                     int cols, std::vector<std::unique_ptr<double[]>>* rows) {
+    static const size_t LINES_PER_THREAD = 256;
+    const size_t offset = rows->size();
+    rows->resize(offset + lines.size());
+    for (size_t i = 0; i < lines.size(); i++) {
+        (*rows)[offset + i].reset(new double[cols]);
+    }
+    std::atomic<bool> failed(false);
+    auto parseRange = [&](size_t first, size_t last) {
+        for (size_t i = first; i < last && !failed.load(std::memory_order_relaxed); i++) {
+            if (parse_text_row(lines[i].first, lines[i].second, delimiter,
+                               (*rows)[offset + i].get(), cols) != cols) {
+                failed = true;
+            }
+        }
+    };
+    const size_t threads = std::min<size_t>(std::max(1u, std::thread::hardware_concurrency()),
+                                            lines.size() / LINES_PER_THREAD + 1);
+    const size_t step = (lines.size() + threads - 1) / threads;
+    std::vector<std::thread> workers;
+    try {
+        workers.reserve(threads - 1);
+        for (size_t t = 1; t < threads; t++) {
+            workers.emplace_back(parseRange, std::min(lines.size(), t * step),
+                                 std::min(lines.size(), (t + 1) * step));
+        }
+    } catch (...) {
+        failed = true;
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+        throw;
+    }
+    parseRange(0, std::min(lines.size(), step));
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    if (failed) {
+        throw std::logic_error("\nWrong matrix text format\n");
+    }
+}
+
+}  // namespace
+
 /**
  * @brief Construct a new S21Matrix::S21Matrix object
  * 
@@ -41,6 +494,17 @@ S21Matrix::S21Matrix(int rows, int cols) :
 S21Matrix::S21Matrix(const S21Matrix& other_matrix) :
     _rows(other_matrix._rows), 
     _cols(other_matrix._cols) {
+#if S21_MATRIX_COW
+    if (!other_matrix._unsharable) {
+        _matrix = other_matrix._matrix;
+        _refs = other_matrix._refs;
+        _unsharable = false;
+        if (_refs) {
+            _refs->fetch_add(1, std::memory_order_relaxed);
+        }
+        return;
+    }
+#endif
     init_matrix(_rows, _cols);
     for (int i = 0; i < _rows; i++) {
         for (int j = 0; j < _cols; j++) {
@@ -54,12 +518,15 @@ S21Matrix::S21Matrix(const S21Matrix& other_matrix) :
  * 
  * @param other_matrix Other Matrix object for move
  */
-S21Matrix::S21Matrix(S21Matrix&& other_matrix) {
+S21Matrix::S21Matrix(S21Matrix&& other_matrix) noexcept {
     _rows = other_matrix._rows;
     _cols = other_matrix._cols;
     _matrix = other_matrix._matrix;
-    other_matrix._cols = other_matrix._rows = 0;
-    other_matrix._matrix = nullptr;
+#if S21_MATRIX_COW
+    _refs = other_matrix._refs;
+    _unsharable = other_matrix._unsharable;
+#endif
+    other_matrix.null_object_field();
 }
 
 /**
@@ -73,20 +540,98 @@ void S21Matrix::init_matrix(int rows, int cols) {
     for (int i = 0; i < rows; i++) {
         _matrix[i] = new double[cols]();
     }
+#if S21_MATRIX_COW
+    _refs = new std::atomic<int>(1);
+    _unsharable = false;
+#endif
 }
 
 /**
- * @brief Clear matrix
+ * @brief Clear matrix, the storage is deleted with its last owner
  * 
  */
 void S21Matrix::free_matrix() {
     if (_matrix) {
+#if S21_MATRIX_COW
+        if (_refs->fetch_sub(1, std::memory_order_acq_rel) > 1) {
+            null_object_field();
+            return;
+        }
+        delete _refs;
+#endif
         for (int i = 0; i < _rows; i++) {
             delete[] _matrix[i];
         }
         delete[] _matrix;
-        _matrix = nullptr;
+        null_object_field();
+    }
+}
+
+/**
+ * @brief Gives the matrix its own copy of a shared storage before a write
+ * 
+ */
+void S21Matrix::detach_matrix() {
+#if S21_MATRIX_COW
+    if (_matrix && _refs->load(std::memory_order_acquire) > 1) {
+        S21Matrix tmpMatrix(_rows, _cols);
+        for (int i = 0; i < _rows; i++) {
+            std::copy(_matrix[i], _matrix[i] + _cols, tmpMatrix._matrix[i]);
+        }
+        swap(tmpMatrix);
+    }
+#endif
+}
+
+/**
+ * @brief Gives the matrix a new storage in place of a shared one without
+ * copying the values, for writes that overwrite every element
+ * 
+ */
+void S21Matrix::discard_shared_matrix() {
+#if S21_MATRIX_COW
+    if (_matrix && _refs->load(std::memory_order_acquire) > 1) {
+        S21Matrix tmpMatrix(_rows, _cols);
+        swap(tmpMatrix);
     }
+#endif
+}
+
+/**
+ * @brief Detaches the storage and keeps later copies off it, since an element
+ * reference handed out can still write to it
+ * 
+ */
+void S21Matrix::mark_unsharable() {
+#if S21_MATRIX_COW
+    detach_matrix();
+    _unsharable = true;
+#endif
+}
+
+/**
+ * @brief Does the matrix share its storage with copies
+ * 
+ * @return true if the storage is shared
+ * @return false if the matrix owns its storage
+ */
+bool S21Matrix::IsShared() const noexcept {
+#if S21_MATRIX_COW
+    return _refs && _refs->load(std::memory_order_acquire) > 1;
+#else
+    return false;
+#endif
+}
+
+/**
+ * @brief Lets copies share the storage again after it was filled through
+ * element references, which must not be written through afterwards
+ * 
+ */
+void S21Matrix::SetSharable() noexcept {
+#if S21_MATRIX_COW
+    _unsharable = false;
+#endif
 }
 
 /**
@@ -96,7 +641,7 @@ void S21Matrix::free_matrix() {
  * @return True if the matrices are identical
  * @return False if the matrices are different
  */
-bool S21Matrix::eq_matrix(const S21Matrix& other_matrix) {
+bool S21Matrix::eq_matrix(const S21Matrix& other_matrix) const {
     static const double EPS = 0.0000001;
     if (valid_matrix(other_matrix) && valid_matrix(*this)
     && other_matrix._rows == _rows && other_matrix._cols == _cols) {
@@ -118,14 +663,13 @@ bool S21Matrix::eq_matrix(const S21Matrix& other_matrix) {
  * 
  * @param other_matrix Other matrix for sum
  */
-void S21Matrix::sum_matrix(const S21Matrix& other_matrix) {
-    if (_rows != other_matrix._rows || _cols != other_matrix._cols) {
-        throw std::invalid_argument("\nThe number of rows and columns must match\n");
-    } else {
-        for (int i = 0; i < _rows; i++) {
-            for (int j = 0; j < _cols; j++) {
-                _matrix[i][j] += other_matrix._matrix[i][j];
-            }
+void S21Matrix::sum_matrix(const S21Matrix& other_matrix) S21_MATRIX_NOEXCEPT {
+    S21_MATRIX_CHECK(_rows == other_matrix._rows && _cols == other_matrix._cols, std::invalid_argument,
+                     "\nThe number of rows and columns must match\n");
+    detach_matrix();
+    for (int i = 0; i < _rows; i++) {
+        for (int j = 0; j < _cols; j++) {
+            _matrix[i][j] += other_matrix._matrix[i][j];
         }
     }
 }
@@ -135,8 +679,9 @@ void S21Matrix::sum_matrix(const S21Matrix& other_matrix) {
  * 
  * @param other_matrix Other matrix for sub
  */
-void S21Matrix::sub_matrix(const S21Matrix& other_matrix) {
+void S21Matrix::sub_matrix(const S21Matrix& other_matrix) S21_MATRIX_NOEXCEPT {
     if (valid_matrix(other_matrix) && valid_matrix(*this) && compare_two_matrix(other_matrix)) {
+        detach_matrix();
         for (int i = 0; i < _rows; i++) {
             for (int j = 0; j < _cols; j++) {
                 _matrix[i][j] -= other_matrix._matrix[i][j];
@@ -150,8 +695,9 @@ void S21Matrix::sub_matrix(const S21Matrix& other_matrix) {
  * 
  * @param Num Number value
  */
-void S21Matrix::mul_number(const double num) {
+void S21Matrix::mul_number(const double num) S21_MATRIX_NOEXCEPT {
     if (valid_matrix(*this)) {
+        detach_matrix();
         for (int i = 0; i < _rows; i++) {
             for (int j = 0; j < _cols; j++) {
                 _matrix[i][j] *= num;
@@ -166,24 +712,137 @@ void S21Matrix::mul_number(const double num) {
  * @param other_matrix Other matrix for multiply
  */
 void S21Matrix::mul_matrix(const S21Matrix& other_matrix) {
-    if ((_cols != other_matrix._rows) || !valid_matrix(*this) || !valid_matrix(other_matrix)) {
-        throw std::logic_error("\nWrong count of rows or columns\n");
-    }
-    int row = _rows;
-    int cols = other_matrix._cols;
+    S21_MATRIX_CHECK(_cols == other_matrix._rows && valid_matrix(*this) && valid_matrix(other_matrix),
+                     std::logic_error, "\nWrong count of rows or columns\n");
     S21Matrix tmpMatrix(_rows, other_matrix._cols);
+    tmpMatrix.mul_matrix_to(*this, other_matrix);
+    swap(tmpMatrix);
+}
+
+/**
+ * @brief Writes the product of two matrices into this preallocated matrix
+ * 
+ * @param first_matrix Left operand, must not share storage with this matrix
+ * @param second_matrix Right operand, must not share storage with this matrix
+ */
+void S21Matrix::mul_matrix_to(const S21Matrix& first_matrix, const S21Matrix& second_matrix) {
+    discard_shared_matrix();
     for (int i = 0; i < _rows; i++) {
-        for (int j = 0; j < other_matrix._cols; j++) {
-            for (int k = 0; k < _cols; k++) {
-                tmpMatrix._matrix[i][j] += _matrix[i][k] * other_matrix._matrix[k][j];
+        double* resultRow = _matrix[i];
+        std::fill(resultRow, resultRow + _cols, 0.0);
+        for (int k = 0; k < first_matrix._cols; k++) {
+            const double factor = first_matrix._matrix[i][k];
+            const double* otherRow = second_matrix._matrix[k];
+            for (int j = 0; j < _cols; j++) {
+                resultRow[j] += factor * otherRow[j];
             }
         }
     }
-    free_matrix();
-    _matrix = tmpMatrix._matrix;
-    _rows = row;
-    _cols = cols;
-    tmpMatrix.null_object_field();
+}
+
+/**
+ * @brief Exchanges the contents of two matrices
+ * 
+ * @param other_matrix Matrix for exchange
+ */
+void S21Matrix::swap(S21Matrix& other_matrix) noexcept {
+    std::swap(_matrix, other_matrix._matrix);
+#if S21_MATRIX_COW
+    std::swap(_refs, other_matrix._refs);
+    std::swap(_unsharable, other_matrix._unsharable);
+#endif
+    std::swap(_rows, other_matrix._rows);
+    std::swap(_cols, other_matrix._cols);
+}
+
+/**
+ * @brief Raises a square matrix to an integer power by repeated squaring
+ * 
+ * Uses O(log n) multiplications over two preallocated work matrices.
+ * A negative power raises the inverse matrix.
+ * 
+ * @param power Power value
+ * @return S21Matrix result matrix
+ */
+S21Matrix S21Matrix::pow(int power) {
+    S21_MATRIX_CHECK(_rows == _cols, std::logic_error, "\nRows and columns must match\n");
+    S21Matrix resultMatrix(_rows, _cols);
+    for (int i = 0; i < _rows; i++) {
+        resultMatrix._matrix[i][i] = 1.0;
+    }
+    S21Matrix baseMatrix(power < 0 ? inverse_matrix() : S21Matrix(*this));
+    S21Matrix tmpMatrix(_rows, _cols);
+    unsigned int exponent = power < 0 ? 0u - static_cast<unsigned int>(power) : power;
+    bool isIdentity = true;
+    while (exponent) {
+        if (exponent & 1u) {
+            if (isIdentity) {
+                resultMatrix.set_flat_matrix(get_flat_matrix(baseMatrix));
+                isIdentity = false;
+            } else {
+                tmpMatrix.mul_matrix_to(resultMatrix, baseMatrix);
+                resultMatrix.swap(tmpMatrix);
+            }
+        }
+        exponent >>= 1;
+        if (exponent) {
+            tmpMatrix.mul_matrix_to(baseMatrix, baseMatrix);
+            baseMatrix.swap(tmpMatrix);
+        }
+    }
+    return resultMatrix;
+}
+
+/**
+ * @brief Matrix exponential by scaling and squaring with a Pade approximant
+ * 
+ * The matrix is scaled by 2^-s until its norm is below 1/2, exp is
+ * approximated by the diagonal Pade approximant of degree 6 and the
+ * result is squared s times.
+ * 
+ * @return S21Matrix result matrix
+ */
+S21Matrix S21Matrix::expm() {
+    static const int PADE_DEGREE = 6;
+    S21_MATRIX_CHECK(_rows == _cols, std::logic_error, "\nRows and columns must match\n");
+    const int n = _rows;
+    int scale = 0;
+    std::frexp(norm_inf(get_flat_matrix(*this).data(), n, n), &scale);
+    scale = std::max(0, scale + 1);
+
+    S21Matrix scaledMatrix(*this);
+    scaledMatrix.mul_number(std::ldexp(1.0, -scale));
+    S21Matrix powerMatrix(scaledMatrix);
+    S21Matrix tmpMatrix(n, n);
+    S21Matrix numeratorMatrix(n, n);
+    S21Matrix denominatorMatrix(n, n);
+    double coefficient = 0.5;
+    for (int i = 0; i < n; i++) {
+        numeratorMatrix._matrix[i][i] = denominatorMatrix._matrix[i][i] = 1.0;
+        for (int j = 0; j < n; j++) {
+            numeratorMatrix._matrix[i][j] += coefficient * scaledMatrix._matrix[i][j];
+            denominatorMatrix._matrix[i][j] -= coefficient * scaledMatrix._matrix[i][j];
+        }
+    }
+    for (int k = 2; k <= PADE_DEGREE; k++) {
+        coefficient *= static_cast<double>(PADE_DEGREE - k + 1) / (k * (2 * PADE_DEGREE - k + 1));
+        tmpMatrix.mul_matrix_to(scaledMatrix, powerMatrix);
+        powerMatrix.swap(tmpMatrix);
+        const double sign = (k % 2) ? -1.0 : 1.0;
+        for (int i = 0; i < n; i++) {
+            for (int j = 0; j < n; j++) {
+                numeratorMatrix._matrix[i][j] += coefficient * powerMatrix._matrix[i][j];
+                denominatorMatrix._matrix[i][j] += sign * coefficient * powerMatrix._matrix[i][j];
+            }
+        }
+    }
+
+    S21Matrix resultMatrix(denominatorMatrix.solve(numeratorMatrix));
+    for (int k = 0; k < scale; k++) {
+        tmpMatrix.mul_matrix_to(resultMatrix, resultMatrix);
+        resultMatrix.swap(tmpMatrix);
+    }
+    return resultMatrix;
 }
 
 /**
@@ -215,7 +874,7 @@ S21Matrix S21Matrix::calc_complements() {
         for (int i = 0; i < _rows; i++) {
             for (int j = 0; j < _cols; j++) {
                 tmpMatrix.get_matrix_minor(*this, i, j);
-                resultMatrix._matrix[i][j] = tmpMatrix.determinant() * pow(-1, i + j);
+                resultMatrix._matrix[i][j] = tmpMatrix.determinant() * std::pow(-1, i + j);
             }
         }
     }
@@ -223,23 +882,21 @@ S21Matrix S21Matrix::calc_complements() {
 }
 
 /**
- * @brief Finds the determinant
+ * @brief Finds the determinant as the signed product of the LU pivots
  * 
- * @return Double determinant
+ * @return Double determinant, 0 for a numerically singular matrix
  */
-double S21Matrix::determinant() {
+double S21Matrix::determinant() const {
     double result = 0.0;
     if (valid_matrix(*this) && is_matrix_square(*this)) {
-        for (int j = 0; j < _cols; j++) {
-            if (_rows == 1) {
-                result = _matrix[0][0];
-            } else if (_rows == 2) {
-                result = _matrix[0][0] * _matrix[1][1] -
-                    _matrix[1][0] * _matrix[0][1];
-            } else {
-                S21Matrix tmpMatrix(_rows - 1, _cols - 1);
-                tmpMatrix.get_matrix_minor(*this, 0, j);
-                result += _matrix[0][j] * pow(-1, j) * tmpMatrix.determinant();
+        const int n = _rows;
+        std::vector<double> lu(get_flat_matrix(*this));
+        std::vector<int> pivots(n);
+        if (lu_factorize(lu.data(), pivots.data(), n)) {
+            result = 1.0;
+            for (int i = 0; i < n; i++) {
+                const double diagonal = lu[static_cast<size_t>(i) * n + i];
+                result *= pivots[i] == i ? diagonal : -diagonal;
             }
         }
     }
@@ -247,50 +904,386 @@ double S21Matrix::determinant() {
 }
 
 /**
- * @brief Creates an inverse matrix
+ * @brief Creates an inverse matrix by solving A * X = I with LU decomposition
  * 
  * @return S21Matrix Returns the finished matrix
  */
 S21Matrix S21Matrix::inverse_matrix() {
-    if (_rows != _cols) {
-    throw std::logic_error("\nRows and columns must match\n");
-    } else if (determinant() == 0.0) {
-    throw std::logic_error(
-        "\ndeterminant value can't be equal to 0\n");
-    }
-    const double determinant = 1 / this->determinant();
-    S21Matrix tmpMatrix(calc_complements());
-    S21Matrix resultMatrix(tmpMatrix.transpose());
-    resultMatrix.mul_number(determinant);
-    return resultMatrix;
+    S21_MATRIX_CHECK(_rows == _cols, std::logic_error, "\nRows and columns must match\n");
+    S21Matrix identityMatrix(_rows, _cols);
+    for (int i = 0; i < _rows; i++) {
+        identityMatrix._matrix[i][i] = 1.0;
+    }
+    return solve(identityMatrix);
 }
 
 /**
- * @brief Gets the truncated matrix
+ * @brief Solves the system A * X = B by LU decomposition with partial pivoting
  * 
- * @param other_matrix Other matrix
- * @param rows Count of rows
- * @param cols Count of columns
- * @return S21Matrix 
+ * @param other_matrix Right-hand side B
+ * @return S21Matrix solution X
  */
-S21Matrix S21Matrix::get_matrix_minor(const S21Matrix& other_matrix, int rows,
-                                          int cols) {
-  for (int i = 0; i < other_matrix._rows; i++) {
-    for (int j = 0; j < other_matrix._cols; j++) {
-      if (i != rows && j != cols) {
-        if (j > cols && i > rows) {
-          _matrix[i - 1][j - 1] = other_matrix._matrix[i][j];
-        } else if (j < cols && i < rows) {
-          _matrix[i][j] = other_matrix._matrix[i][j];
-        } else if (j > cols && i < rows) {
-          _matrix[i][j - 1] = other_matrix._matrix[i][j];
-        } else if (j < cols && i > rows) {
-          _matrix[i - 1][j] = other_matrix._matrix[i][j];
-        }
-      }
+S21Matrix S21Matrix::solve(const S21Matrix& other_matrix) {
+    S21_MATRIX_CHECK(_rows == _cols, std::logic_error, "\nRows and columns must match\n");
+    S21_MATRIX_CHECK(other_matrix._rows == _rows, std::logic_error, "\nWrong count of rows or columns\n");
+    const int n = _rows;
+    const int m = other_matrix._cols;
+    std::vector<double> lu(get_flat_matrix(*this));
+    std::vector<int> pivots(n);
+    if (!lu_factorize(lu.data(), pivots.data(), n)) {
+        throw std::logic_error("\ndeterminant value can't be equal to 0\n");
     }
-  }
-  return *this;
+    std::vector<double> x(get_flat_matrix(other_matrix));
+    lu_substitute(lu.data(), pivots.data(), n, x.data(), m);
+    S21Matrix resultMatrix(n, m);
+    resultMatrix.set_flat_matrix(x);
+    return resultMatrix;
+}
+
+/**
+ * @brief Solves the system A * X = B in mixed precision
+ * 
+ * The LU factorization and the correction solves run in single precision,
+ * the residuals in double precision. If iterative refinement stagnates
+ * before reaching double accuracy, the system is solved again in double.
+ * 
+ * @param other_matrix Right-hand side B
+ * @param residual If not null, receives ||B - A * X|| / (||A|| * ||X||)
+ * @return S21Matrix solution X
+ */
+S21Matrix S21Matrix::solve_mixed(const S21Matrix& other_matrix, double* residual) {
+    static const int MAX_ITERATIONS = 30;
+    S21_MATRIX_CHECK(_rows == _cols, std::logic_error, "\nRows and columns must match\n");
+    S21_MATRIX_CHECK(other_matrix._rows == _rows, std::logic_error, "\nWrong count of rows or columns\n");
+    const int n = _rows;
+    const int m = other_matrix._cols;
+    const std::vector<double> a(get_flat_matrix(*this));
+    const std::vector<double> b(get_flat_matrix(other_matrix));
+    const double tolerance = std::sqrt(static_cast<double>(n)) * DBL_EPSILON;
+    std::vector<double> x(b.size());
+    std::vector<double> r(b.size());
+    double error = 0.0;
+    bool converged = false;
+
+    std::vector<float> lu(a.begin(), a.end());
+    std::vector<int> pivots(n);
+    if (norm_inf(a.data(), n, n) < FLT_MAX && lu_factorize(lu.data(), pivots.data(), n)) {
+        std::vector<float> correction(b.begin(), b.end());
+        lu_substitute(lu.data(), pivots.data(), n, correction.data(), m);
+        x.assign(correction.begin(), correction.end());
+        double previous = HUGE_VAL;
+        for (int iteration = 0; iteration < MAX_ITERATIONS; iteration++) {
+            error = residual_error(a, x, b, &r, n, m);
+            if (error <= tolerance) {
+                converged = true;
+                break;
+            } else if (!(error < previous)) {
+                break;
+            }
+            previous = error;
+            correction.assign(r.begin(), r.end());
+            lu_substitute(lu.data(), pivots.data(), n, correction.data(), m);
+            for (size_t i = 0; i < x.size(); i++) {
+                x[i] += correction[i];
+            }
+        }
+    }
+
+    if (!converged) {
+        S21Matrix resultMatrix(solve(other_matrix));
+        error = residual_error(a, get_flat_matrix(resultMatrix), b, &r, n, m);
+        if (residual) {
+            *residual = error;
+        }
+        return resultMatrix;
+    }
+    S21Matrix resultMatrix(n, m);
+    resultMatrix.set_flat_matrix(x);
+    if (residual) {
+        *residual = error;
+    }
+    return resultMatrix;
+}
+
+/**
+ * @brief Thin QR decomposition A = Q * R from a single Householder factorization
+ * 
+ * Both factors are computed before either output is written, so q or r
+ * may point to this matrix.
+ * 
+ * @param q If not null, receives the rows x cols matrix with orthonormal columns
+ * @param r If not null, receives the cols x cols upper triangular matrix
+ */
+void S21Matrix::qr(S21Matrix* q, S21Matrix* r) {
+    S21_MATRIX_CHECK(_rows >= _cols, std::logic_error, "\nRows can't be less than columns\n");
+    const int rows = _rows;
+    const int cols = _cols;
+    S21Matrix qrMatrix(*this);
+    qrMatrix.detach_matrix();
+    const std::vector<double> tau(householder_qr(qrMatrix._matrix, rows, cols));
+    S21Matrix rMatrix;
+    if (r) {
+        S21Matrix resultMatrix(cols, cols);
+        for (int i = 0; i < cols; i++) {
+            std::copy(qrMatrix._matrix[i] + i, qrMatrix._matrix[i] + cols, resultMatrix._matrix[i] + i);
+        }
+        rMatrix.swap(resultMatrix);
+    }
+    S21Matrix qMatrix;
+    if (q) {
+        S21Matrix resultMatrix(rows, cols);
+        for (int i = 0; i < cols; i++) {
+            resultMatrix._matrix[i][i] = 1.0;
+        }
+        apply_householder_q(qrMatrix._matrix, rows, cols, tau, resultMatrix._matrix, cols, false);
+        qMatrix.swap(resultMatrix);
+    }
+    if (r) {
+        r->swap(rMatrix);
+    }
+    if (q) {
+        q->swap(qMatrix);
+    }
+}
+
+/**
+ * @brief Gets the orthonormal factor Q of the thin QR decomposition
+ * 
+ * @return S21Matrix rows x cols matrix with orthonormal columns
+ */
+S21Matrix S21Matrix::qr_q() {
+    S21Matrix resultMatrix;
+    qr(&resultMatrix, nullptr);
+    return resultMatrix;
+}
+
+/**
+ * @brief Gets the upper triangular factor R of the thin QR decomposition
+ * 
+ * @return S21Matrix cols x cols upper triangular matrix
+ */
+S21Matrix S21Matrix::qr_r() {
+    S21Matrix resultMatrix;
+    qr(nullptr, &resultMatrix);
+    return resultMatrix;
+}
+
+/**
+ * @brief Solves the least squares problem min ||A * X - B|| by Householder QR
+ * 
+ * @param other_matrix Right-hand side B with the same count of rows
+ * @return S21Matrix cols x B.cols solution X
+ */
+S21Matrix S21Matrix::least_squares(const S21Matrix& other_matrix) {
+    S21_MATRIX_CHECK(_rows >= _cols, std::logic_error, "\nRows can't be less than columns\n");
+    S21_MATRIX_CHECK(other_matrix._rows == _rows, std::logic_error, "\nWrong count of rows or columns\n");
+    S21Matrix qrMatrix(*this);
+    qrMatrix.detach_matrix();
+    const std::vector<double> tau(householder_qr(qrMatrix._matrix, _rows, _cols));
+    S21Matrix rhsMatrix(other_matrix);
+    rhsMatrix.detach_matrix();
+    const int m = other_matrix._cols;
+    apply_householder_q(qrMatrix._matrix, _rows, _cols, tau, rhsMatrix._matrix, m, true);
+    S21Matrix resultMatrix(_cols, m);
+    for (int i = _cols - 1; i >= 0; i--) {
+        const double diagonal = qrMatrix._matrix[i][i];
+        if (diagonal == 0.0) {
+            throw std::logic_error("\nMatrix columns are linearly dependent\n");
+        }
+        double* rowX = resultMatrix._matrix[i];
+        std::copy(rhsMatrix._matrix[i], rhsMatrix._matrix[i] + m, rowX);
+        for (int k = i + 1; k < _cols; k++) {
+            const double factor = qrMatrix._matrix[i][k];
+            const double* rowK = resultMatrix._matrix[k];
+            for (int j = 0; j < m; j++) {
+                rowX[j] -= factor * rowK[j];
+            }
+        }
+        for (int j = 0; j < m; j++) {
+            rowX[j] /= diagonal;
+        }
+    }
+    return resultMatrix;
+}
+
+/**
+ * @brief Reads the matrix from delimited text, one matrix row per line
+ * 
+ * The stream is read in large chunks and the complete lines of every chunk
+ * are parsed in parallel directly into the new matrix rows. Empty lines are skipped.
+ * 
+ * @param stream Input stream
+ * @param delimiter Field delimiter, ' ' for any whitespace
+ */
+void S21Matrix::read_text(std::istream& stream, char delimiter) {
+    static const size_t CHUNK_SIZE = 16 << 20;
+    std::vector<std::unique_ptr<double[]>> rows;
+    std::vector<std::pair<const char*, const char*>> lines;
+    std::string buffer;
+    size_t carry = 0;
+    int cols = 0;
+    bool last = false;
+    while (!last) {
+        buffer.resize(carry + CHUNK_SIZE);
+        stream.read(&buffer[carry], CHUNK_SIZE);
+        const size_t size = carry + static_cast<size_t>(stream.gcount());
+        last = !stream;
+        const char* data = buffer.data();
+        const char* current = data;
+        const char* end = data + size;
+        lines.clear();
+        while (current < end) {
+            const char* lineEnd = static_cast<const char*>(std::memchr(current, '\n', end - current));
+            if (!lineEnd) {
+                if (!last) {
+                    break;
+                }
+                lineEnd = end;
+            }
+            if (skip_blanks(current, lineEnd, delimiter) != lineEnd) {
+                lines.emplace_back(current, lineEnd);
+            }
+            current = lineEnd < end ? lineEnd + 1 : end;
+        }
+        if (!lines.empty() && cols == 0) {
+            cols = parse_text_row(lines[0].first, lines[0].second, delimiter, nullptr, 0);
+            if (cols <= 0) {
+                throw std::logic_error("\nWrong matrix text format\n");
+            }
+        }
+        parse_text_rows(lines, delimiter, cols, &rows);
+        carry = end - current;
+        std::memmove(&buffer[0], current, carry);
+    }
+    if (rows.empty()) {
+        throw std::logic_error("\nWrong value of rows or columns\n");
+    }
+    free_matrix();
+    _rows = static_cast<int>(rows.size());
+    _cols = cols;
+    _matrix = new double*[_rows];
+    for (int i = 0; i < _rows; i++) {
+        _matrix[i] = rows[i].release();
+    }
+#if S21_MATRIX_COW
+    _refs = new std::atomic<int>(1);
+    _unsharable = false;
+#endif
+}
+
+/**
+ * @brief Writes the matrix as delimited text, one matrix row per line
+ * 
+ * Values are written in the shortest form that reads back to the same double.
+ * 
+ * @param stream Output stream
+ * @param delimiter Field delimiter
+ */
+void S21Matrix::write_text(std::ostream& stream, char delimiter) {
+    static const size_t BUFFER_SIZE = 1 << 20;
+    std::string buffer;
+    buffer.reserve(BUFFER_SIZE + 64);
+    char field[64];
+    for (int i = 0; i < _rows; i++) {
+        for (int j = 0; j < _cols; j++) {
+            const std::to_chars_result result = std::to_chars(field, field + sizeof(field), _matrix[i][j]);
+            buffer.append(field, result.ptr);
+            buffer.push_back(j + 1 < _cols ? delimiter : '\n');
+            if (buffer.size() >= BUFFER_SIZE) {
+                stream.write(buffer.data(), buffer.size());
+                buffer.clear();
+            }
+        }
+    }
+    stream.write(buffer.data(), buffer.size());
+    if (!stream) {
+        throw std::logic_error("\nCan't write matrix\n");
+    }
+}
+
+/**
+ * @brief Reads the matrix from a CSV or whitespace-delimited text file
+ * 
+ * @param path File path
+ * @param delimiter Field delimiter, ' ' for any whitespace
+ */
+void S21Matrix::load_file(const std::string& path, char delimiter) {
+    std::ifstream stream(path, std::ios::binary);
+    if (!stream) {
+        throw std::logic_error("\nCan't open file\n");
+    }
+    read_text(stream, delimiter);
+}
+
+/**
+ * @brief Writes the matrix to a CSV or whitespace-delimited text file
+ * 
+ * @param path File path
+ * @param delimiter Field delimiter
+ */
+void S21Matrix::save_file(const std::string& path, char delimiter) {
+    std::ofstream stream(path, std::ios::binary);
+    if (!stream) {
+        throw std::logic_error("\nCan't open file\n");
+    }
+    write_text(stream, delimiter);
+}
+
+/**
+ * @brief Copies the matrix values into a row-major array
+ * 
+ * @param other_matrix Matrix for copy
+ * @return std::vector<double> row-major values
+ */
+std::vector<double> S21Matrix::get_flat_matrix(const S21Matrix& other_matrix) const {
+    std::vector<double> result(static_cast<size_t>(other_matrix._rows) * other_matrix._cols);
+    for (int i = 0; i < other_matrix._rows; i++) {
+        std::copy(other_matrix._matrix[i], other_matrix._matrix[i] + other_matrix._cols,
+                  result.begin() + static_cast<size_t>(i) * other_matrix._cols);
+    }
+    return result;
+}
+
+/**
+ * @brief Fills the matrix from a row-major array of matching size
+ * 
+ * @param values Row-major values
+ */
+void S21Matrix::set_flat_matrix(const std::vector<double>& values) {
+    discard_shared_matrix();
+    for (int i = 0; i < _rows; i++) {
+        std::copy(values.begin() + static_cast<size_t>(i) * _cols,
+                  values.begin() + static_cast<size_t>(i + 1) * _cols, _matrix[i]);
+    }
+}
+
+/**
+ * @brief Gets the truncated matrix
+ * 
+ * @param other_matrix Other matrix
+ * @param rows Count of rows
+ * @param cols Count of columns
+ * @return S21Matrix 
+ */
+S21Matrix S21Matrix::get_matrix_minor(const S21Matrix& other_matrix, int rows,
+                                          int cols) {
+  detach_matrix();
+  for (int i = 0; i < other_matrix._rows; i++) {
+    for (int j = 0; j < other_matrix._cols; j++) {
+      if (i != rows && j != cols) {
+        if (j > cols && i > rows) {
+          _matrix[i - 1][j - 1] = other_matrix._matrix[i][j];
+        } else if (j < cols && i < rows) {
+          _matrix[i][j] = other_matrix._matrix[i][j];
+        } else if (j > cols && i < rows) {
+          _matrix[i][j - 1] = other_matrix._matrix[i][j];
+        } else if (j < cols && i > rows) {
+          _matrix[i - 1][j] = other_matrix._matrix[i][j];
+        }
+      }
+    }
+  }
+  return *this;
 }
 
 /**
@@ -300,10 +1293,8 @@ S21Matrix S21Matrix::get_matrix_minor(const S21Matrix& other_matrix, int rows,
  * @return true if matrix is square
  * @return false if matrix is not square
  */
-bool S21Matrix::is_matrix_square(const S21Matrix& other_matrix) {
-    if (other_matrix._rows != other_matrix._cols) {
-        throw std::logic_error("\nMatrix is not square\n");
-    }
+bool S21Matrix::is_matrix_square(const S21Matrix& other_matrix) const {
+    S21_MATRIX_CHECK(other_matrix._rows == other_matrix._cols, std::logic_error, "\nMatrix is not square\n");
     return true;
 }
 
@@ -314,11 +1305,10 @@ bool S21Matrix::is_matrix_square(const S21Matrix& other_matrix) {
  * @return True if matrices are correct
  * @return False if matrices are incorrect
  */
-bool S21Matrix::valid_matrix(const S21Matrix& other_matrix) {
-    if ((other_matrix._matrix == nullptr) || (other_matrix._rows <= 0) || (other_matrix._cols <= 0)
-    || (other_matrix._rows == 1 && other_matrix._cols == 1)) {
-        throw std::logic_error("\nWrong value of some class field\n");
-    }
+bool S21Matrix::valid_matrix(const S21Matrix& other_matrix) const {
+    S21_MATRIX_CHECK(other_matrix._matrix != nullptr && other_matrix._rows > 0 && other_matrix._cols > 0
+                     && !(other_matrix._rows == 1 && other_matrix._cols == 1),
+                     std::logic_error, "\nWrong value of some class field\n");
     return true;
 }
 
@@ -330,6 +1320,10 @@ bool S21Matrix::valid_matrix(const S21Matrix& other_matrix) {
 void S21Matrix::null_object_field() {
     _rows = _cols = 0;
     _matrix = nullptr;
+#if S21_MATRIX_COW
+    _refs = nullptr;
+    _unsharable = false;
+#endif
 }
 
 /**
@@ -339,10 +1333,9 @@ void S21Matrix::null_object_field() {
  * @return True if matrices are identical
  * @return False if matrices are different
  */
-bool S21Matrix::compare_two_matrix(const S21Matrix& other_matrix) {
-    if (other_matrix._rows != _rows && other_matrix._cols != _cols) {
-        throw std::logic_error("\nMatrices are non-identical\n");
-    }
+bool S21Matrix::compare_two_matrix(const S21Matrix& other_matrix) const {
+    S21_MATRIX_CHECK(other_matrix._rows == _rows || other_matrix._cols == _cols, std::logic_error,
+                     "\nMatrices are non-identical\n");
     return true;
 }
 
@@ -351,7 +1344,7 @@ bool S21Matrix::compare_two_matrix(const S21Matrix& other_matrix) {
  * 
  * @return Int matrix rows value
  */
-int S21Matrix::GetRows() {
+int S21Matrix::GetRows() const {
     return _rows;
 }
 
@@ -374,10 +1367,7 @@ void S21Matrix::SetRows(int rows) {
             }
         }
     }
-    free_matrix();
-    _matrix = tmpMatrix._matrix;
-    _rows = rows;
-    tmpMatrix.null_object_field();
+    swap(tmpMatrix);
 }
 
 /**
@@ -399,10 +1389,7 @@ void S21Matrix::SetColumns(int cols) {
             }
         }
     }
-    free_matrix();
-    _matrix = tmpMatrix._matrix;
-    _cols = cols;
-    tmpMatrix.null_object_field();
+    swap(tmpMatrix);
 }
 
 /**
@@ -410,7 +1397,7 @@ void S21Matrix::SetColumns(int cols) {
  * 
  * @return Int matrix columns value
  */
-int S21Matrix::GetCols() {
+int S21Matrix::GetCols() const {
     return _cols;
 }
 
@@ -419,7 +1406,7 @@ int S21Matrix::GetCols() {
  * 
  * @param other_matrix Matrix object
  */
-void S21Matrix::operator+=(const S21Matrix& other_matrix) {
+void S21Matrix::operator+=(const S21Matrix& other_matrix) S21_MATRIX_NOEXCEPT {
     sum_matrix(other_matrix);
 }
 
@@ -428,7 +1415,7 @@ void S21Matrix::operator+=(const S21Matrix& other_matrix) {
  * 
  * @param other_matrix Matrix object
  */
-void S21Matrix::operator-=(const S21Matrix& other_matrix) {
+void S21Matrix::operator-=(const S21Matrix& other_matrix) S21_MATRIX_NOEXCEPT {
     sub_matrix(other_matrix);
 }
 
@@ -446,7 +1433,7 @@ void S21Matrix::operator*=(const S21Matrix& other_matrix) {
  * 
  * @param num Number value
  */
-void S21Matrix::operator*=(double num) {
+void S21Matrix::operator*=(double num) S21_MATRIX_NOEXCEPT {
     mul_number(num);
 }
 
@@ -455,8 +1442,8 @@ void S21Matrix::operator*=(double num) {
  * 
  * @param other_matrix Matrix object
  */
-void S21Matrix::operator=(S21Matrix&& other_matrix) {
-    std::swap(*this, other_matrix);
+void S21Matrix::operator=(S21Matrix&& other_matrix) noexcept {
+    swap(other_matrix);
 }
 
 /**
@@ -466,10 +1453,21 @@ void S21Matrix::operator=(S21Matrix&& other_matrix) {
  * @param cols Columns value
  * @return Double& matrtx value
  */
-double& S21Matrix::operator()(int rows, int cols) {
-    if (rows >= _rows || cols >= _cols) {
-        throw std::logic_error("\nIndex out of range\n");
-    }
+double& S21Matrix::operator()(int rows, int cols) S21_MATRIX_NOEXCEPT {
+    S21_MATRIX_CHECK(rows < _rows && cols < _cols, std::logic_error, "\nIndex out of range\n");
+    mark_unsharable();
+    return _matrix[rows][cols];
+}
+
+/**
+ * @brief Operator parentheses overload for reading, never copies a shared storage
+ * 
+ * @param rows Rows value
+ * @param cols Columns value
+ * @return Double matrix value
+ */
+double S21Matrix::operator()(int rows, int cols) const noexcept(S21_MATRIX_CHECKS != S21_MATRIX_CHECKS_FULL) {
+    S21_MATRIX_CHECK(rows < _rows && cols < _cols, std::logic_error, "\nIndex out of range\n");
     return _matrix[rows][cols];
 }
 
@@ -480,7 +1478,7 @@ double& S21Matrix::operator()(int rows, int cols) {
  * @return True if matrices are idntity
  * @return False if matrices are different
  */
-bool S21Matrix::operator==(const S21Matrix& other_matrix) {
+bool S21Matrix::operator==(const S21Matrix& other_matrix) const {
     return eq_matrix(other_matrix);
 }
 
@@ -531,3 +1529,1061 @@ S21Matrix S21Matrix::operator*(double num) {
     resultMatrix.mul_number(num);
     return resultMatrix;
 }
+
+/**
+ * @brief Construct a new S21TriangularMatrix::S21TriangularMatrix object
+ * 
+ * @param size Count of rows and columns
+ * @param upper True for an upper, false for a lower triangular matrix
+ */
+S21TriangularMatrix::S21TriangularMatrix(int size, bool upper) :
+    _size(size),
+    _upper(upper) {
+    if (size < 1) {
+        throw std::logic_error("\nWrong value of rows or columns\n");
+    }
+    _values.assign(static_cast<size_t>(size) * (size + 1) / 2, 0.0);
+}
+
+/**
+ * @brief Construct a new S21TriangularMatrix::S21TriangularMatrix object from a triangle of a matrix
+ * 
+ * @param other_matrix Square matrix, the other triangle is ignored
+ * @param upper True to take the upper, false to take the lower triangle
+ */
+S21TriangularMatrix::S21TriangularMatrix(const S21Matrix& other_matrix, bool upper) :
+    S21TriangularMatrix(other_matrix._rows, upper) {
+    S21_MATRIX_CHECK(other_matrix._rows == other_matrix._cols, std::logic_error, "\nMatrix is not square\n");
+    for (int i = 0; i < _size; i++) {
+        const int first = _upper ? i : 0;
+        const int last = _upper ? _size : i + 1;
+        std::copy(other_matrix._matrix[i] + first, other_matrix._matrix[i] + last,
+                  _values.begin() + get_index(i, first));
+    }
+}
+
+/**
+ * @brief Position of an element in the packed row-major storage
+ * 
+ * @return size_t index of the element
+ */
+size_t S21TriangularMatrix::get_index(int rows, int cols) const {
+    const size_t row = rows;
+    return _upper ? row * _size - row * (row - 1) / 2 + (cols - rows) : row * (row + 1) / 2 + cols;
+}
+
+/**
+ * @brief Get count of matrix rows and columns
+ * 
+ * @return Int matrix size
+ */
+int S21TriangularMatrix::GetSize() const {
+    return _size;
+}
+
+/**
+ * @brief Is the matrix upper triangular
+ * 
+ * @return true if the matrix is upper triangular
+ * @return false if the matrix is lower triangular
+ */
+bool S21TriangularMatrix::IsUpper() const {
+    return _upper;
+}
+
+/**
+ * @brief Operator parentheses overload, only the stored triangle is accessible
+ * 
+ * @param rows Rows value
+ * @param cols Columns value
+ * @return Double& matrix value
+ */
+double& S21TriangularMatrix::operator()(int rows, int cols) {
+    S21_MATRIX_CHECK(rows >= 0 && rows < _size && cols >= 0 && cols < _size
+                     && (_upper ? cols >= rows : cols <= rows),
+                     std::logic_error, "\nIndex out of range\n");
+    return _values[get_index(rows, cols)];
+}
+
+/**
+ * @brief Operator parentheses overload for reading, the other triangle reads as zero
+ * 
+ * @param rows Rows value
+ * @param cols Columns value
+ * @return Double matrix value
+ */
+double S21TriangularMatrix::operator()(int rows, int cols) const {
+    S21_MATRIX_CHECK(rows >= 0 && rows < _size && cols >= 0 && cols < _size,
+                     std::logic_error, "\nIndex out of range\n");
+    return (_upper ? cols >= rows : cols <= rows) ? _values[get_index(rows, cols)] : 0.0;
+}
+
+/**
+ * @brief Converts to a dense matrix
+ * 
+ * @return S21Matrix result matrix
+ */
+S21Matrix S21TriangularMatrix::to_matrix() const {
+    S21Matrix resultMatrix(_size, _size);
+    for (int i = 0; i < _size; i++) {
+        const int first = _upper ? i : 0;
+        const int last = _upper ? _size : i + 1;
+        const double* row = _values.data() + get_index(i, first);
+        std::copy(row, row + (last - first), resultMatrix._matrix[i] + first);
+    }
+    return resultMatrix;
+}
+
+/**
+ * @brief Multiplies the triangular matrix by a dense matrix
+ * 
+ * @param other_matrix Right operand
+ * @return S21Matrix result matrix
+ */
+S21Matrix S21TriangularMatrix::mul_matrix(const S21Matrix& other_matrix) const {
+    S21_MATRIX_CHECK(other_matrix._rows == _size, std::logic_error, "\nWrong count of rows or columns\n");
+    const int m = other_matrix._cols;
+    S21Matrix resultMatrix(_size, m);
+    for (int i = 0; i < _size; i++) {
+        const int first = _upper ? i : 0;
+        const int last = _upper ? _size : i + 1;
+        const double* row = _values.data() + get_index(i, first);
+        double* resultRow = resultMatrix._matrix[i];
+        for (int k = first; k < last; k++) {
+            const double factor = row[k - first];
+            const double* otherRow = other_matrix._matrix[k];
+            for (int j = 0; j < m; j++) {
+                resultRow[j] += factor * otherRow[j];
+            }
+        }
+    }
+    return resultMatrix;
+}
+
+/**
+ * @brief Solves the triangular system T * X = B by substitution
+ * 
+ * @param other_matrix Right-hand side B
+ * @return S21Matrix solution X
+ */
+S21Matrix S21TriangularMatrix::solve(const S21Matrix& other_matrix) const {
+    S21_MATRIX_CHECK(other_matrix._rows == _size, std::logic_error, "\nWrong count of rows or columns\n");
+    const int m = other_matrix._cols;
+    S21Matrix resultMatrix(other_matrix);
+    resultMatrix.detach_matrix();
+    for (int step = 0; step < _size; step++) {
+        const int i = _upper ? _size - 1 - step : step;
+        const int first = _upper ? i + 1 : 0;
+        const int last = _upper ? _size : i;
+        double* rowX = resultMatrix._matrix[i];
+        for (int k = first; k < last; k++) {
+            const double factor = _values[get_index(i, k)];
+            const double* rowK = resultMatrix._matrix[k];
+            for (int j = 0; j < m; j++) {
+                rowX[j] -= factor * rowK[j];
+            }
+        }
+        const double diagonal = _values[get_index(i, i)];
+        if (diagonal == 0.0) {
+            throw std::logic_error("\ndeterminant value can't be equal to 0\n");
+        }
+        for (int j = 0; j < m; j++) {
+            rowX[j] /= diagonal;
+        }
+    }
+    return resultMatrix;
+}
+
+/**
+ * @brief Finds the determinant as the product of the diagonal
+ * 
+ * @return Double determinant
+ */
+double S21TriangularMatrix::determinant() const {
+    double result = 1.0;
+    for (int i = 0; i < _size; i++) {
+        result *= _values[get_index(i, i)];
+    }
+    return result;
+}
+
+/**
+ * @brief Construct a new S21SymmetricMatrix::S21SymmetricMatrix object
+ * 
+ * @param size Count of rows and columns
+ */
+S21SymmetricMatrix::S21SymmetricMatrix(int size) :
+    _size(size) {
+    if (size < 1) {
+        throw std::logic_error("\nWrong value of rows or columns\n");
+    }
+    _values.assign(static_cast<size_t>(size) * (size + 1) / 2, 0.0);
+}
+
+/**
+ * @brief Construct a new S21SymmetricMatrix::S21SymmetricMatrix object from a matrix
+ * 
+ * @param other_matrix Square matrix, only its lower triangle is read
+ */
+S21SymmetricMatrix::S21SymmetricMatrix(const S21Matrix& other_matrix) :
+    S21SymmetricMatrix(other_matrix._rows) {
+    S21_MATRIX_CHECK(other_matrix._rows == other_matrix._cols, std::logic_error, "\nMatrix is not square\n");
+    for (int i = 0; i < _size; i++) {
+        std::copy(other_matrix._matrix[i], other_matrix._matrix[i] + i + 1,
+                  _values.begin() + get_index(i, 0));
+    }
+}
+
+/**
+ * @brief Position of an element in the packed lower triangle
+ * 
+ * @return size_t index of the element
+ */
+size_t S21SymmetricMatrix::get_index(int rows, int cols) const {
+    if (cols > rows) {
+        std::swap(rows, cols);
+    }
+    return static_cast<size_t>(rows) * (rows + 1) / 2 + cols;
+}
+
+/**
+ * @brief Get count of matrix rows and columns
+ * 
+ * @return Int matrix size
+ */
+int S21SymmetricMatrix::GetSize() const {
+    return _size;
+}
+
+/**
+ * @brief Operator parentheses overload, (rows, cols) and (cols, rows) are the same element
+ * 
+ * @param rows Rows value
+ * @param cols Columns value
+ * @return Double& matrix value
+ */
+double& S21SymmetricMatrix::operator()(int rows, int cols) {
+    S21_MATRIX_CHECK(rows >= 0 && rows < _size && cols >= 0 && cols < _size,
+                     std::logic_error, "\nIndex out of range\n");
+    return _values[get_index(rows, cols)];
+}
+
+/**
+ * @brief Operator parentheses overload for reading
+ * 
+ * @param rows Rows value
+ * @param cols Columns value
+ * @return Double matrix value
+ */
+double S21SymmetricMatrix::operator()(int rows, int cols) const {
+    S21_MATRIX_CHECK(rows >= 0 && rows < _size && cols >= 0 && cols < _size,
+                     std::logic_error, "\nIndex out of range\n");
+    return _values[get_index(rows, cols)];
+}
+
+/**
+ * @brief Converts to a dense matrix
+ * 
+ * @return S21Matrix result matrix
+ */
+S21Matrix S21SymmetricMatrix::to_matrix() const {
+    S21Matrix resultMatrix(_size, _size);
+    for (int i = 0; i < _size; i++) {
+        for (int j = 0; j <= i; j++) {
+            resultMatrix._matrix[i][j] = resultMatrix._matrix[j][i] = _values[get_index(i, j)];
+        }
+    }
+    return resultMatrix;
+}
+
+/**
+ * @brief Multiplies the symmetric matrix by a dense matrix reading each stored element once
+ * 
+ * @param other_matrix Right operand
+ * @return S21Matrix result matrix
+ */
+S21Matrix S21SymmetricMatrix::mul_matrix(const S21Matrix& other_matrix) const {
+    S21_MATRIX_CHECK(other_matrix._rows == _size, std::logic_error, "\nWrong count of rows or columns\n");
+    const int m = other_matrix._cols;
+    S21Matrix resultMatrix(_size, m);
+    for (int i = 0; i < _size; i++) {
+        const double* row = _values.data() + get_index(i, 0);
+        double* resultRow = resultMatrix._matrix[i];
+        const double* otherRowI = other_matrix._matrix[i];
+        for (int k = 0; k < i; k++) {
+            const double factor = row[k];
+            const double* otherRowK = other_matrix._matrix[k];
+            double* resultRowK = resultMatrix._matrix[k];
+            for (int j = 0; j < m; j++) {
+                resultRow[j] += factor * otherRowK[j];
+                resultRowK[j] += factor * otherRowI[j];
+            }
+        }
+        for (int j = 0; j < m; j++) {
+            resultRow[j] += row[i] * otherRowI[j];
+        }
+    }
+    return resultMatrix;
+}
+
+/**
+ * @brief Cholesky factorization A = L * L^T into a preallocated lower factor
+ * 
+ * @param factor Lower triangular matrix of the same size
+ * @return True if the matrix is positive definite
+ */
+bool S21SymmetricMatrix::cholesky_to(S21TriangularMatrix* factor) const {
+    for (int i = 0; i < _size; i++) {
+        double* rowI = factor->_values.data() + factor->get_index(i, 0);
+        const double* row = _values.data() + get_index(i, 0);
+        for (int j = 0; j <= i; j++) {
+            const double* rowJ = factor->_values.data() + factor->get_index(j, 0);
+            double sum = row[j];
+            for (int k = 0; k < j; k++) {
+                sum -= rowI[k] * rowJ[k];
+            }
+            if (i != j) {
+                rowI[j] = sum / rowJ[j];
+            } else if (sum > 0.0) {
+                rowI[i] = std::sqrt(sum);
+            } else {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Cholesky factorization A = L * L^T
+ * 
+ * @return S21TriangularMatrix lower triangular factor L
+ */
+S21TriangularMatrix S21SymmetricMatrix::cholesky() const {
+    S21TriangularMatrix factor(_size);
+    if (!cholesky_to(&factor)) {
+        throw std::logic_error("\nMatrix is not positive definite\n");
+    }
+    return factor;
+}
+
+/**
+ * @brief Solves the positive definite system A * X = B by Cholesky factorization
+ * 
+ * @param other_matrix Right-hand side B
+ * @return S21Matrix solution X
+ */
+S21Matrix S21SymmetricMatrix::solve(const S21Matrix& other_matrix) const {
+    S21TriangularMatrix factor(cholesky());
+    S21Matrix resultMatrix(factor.solve(other_matrix));
+    const int m = other_matrix._cols;
+    for (int i = _size - 1; i >= 0; i--) {
+        const double* row = factor._values.data() + factor.get_index(i, 0);
+        double* rowX = resultMatrix._matrix[i];
+        for (int j = 0; j < m; j++) {
+            rowX[j] /= row[i];
+        }
+        for (int k = 0; k < i; k++) {
+            double* rowK = resultMatrix._matrix[k];
+            for (int j = 0; j < m; j++) {
+                rowK[j] -= row[k] * rowX[j];
+            }
+        }
+    }
+    return resultMatrix;
+}
+
+/**
+ * @brief Finds the determinant by Cholesky factorization, or by LU for indefinite matrices
+ * 
+ * @return Double determinant
+ */
+double S21SymmetricMatrix::determinant() const {
+    S21TriangularMatrix factor(_size);
+    if (cholesky_to(&factor)) {
+        const double root = factor.determinant();
+        return root * root;
+    }
+    std::vector<double> lu(static_cast<size_t>(_size) * _size);
+    for (int i = 0; i < _size; i++) {
+        for (int j = 0; j < _size; j++) {
+            lu[static_cast<size_t>(i) * _size + j] = _values[get_index(i, j)];
+        }
+    }
+    std::vector<int> pivots(_size);
+    if (!lu_factorize(lu.data(), pivots.data(), _size)) {
+        return 0.0;
+    }
+    double result = 1.0;
+    for (int i = 0; i < _size; i++) {
+        const double diagonal = lu[static_cast<size_t>(i) * _size + i];
+        result *= pivots[i] == i ? diagonal : -diagonal;
+    }
+    return result;
+}
+
+/**
+ * @brief Construct a new S21BandMatrix::S21BandMatrix object
+ * 
+ * @param size Count of rows and columns
+ * @param lower Count of subdiagonals
+ * @param upper Count of superdiagonals
+ */
+S21BandMatrix::S21BandMatrix(int size, int lower, int upper) :
+    _size(size),
+    _lower(std::min(lower, size - 1)),
+    _upper(std::min(upper, size - 1)) {
+    if (size < 1 || lower < 0 || upper < 0) {
+        throw std::logic_error("\nWrong value of rows or columns\n");
+    }
+    _values.assign(static_cast<size_t>(_size) * (_lower + _upper + 1), 0.0);
+}
+
+/**
+ * @brief Construct a new S21BandMatrix::S21BandMatrix object from the band of a matrix
+ * 
+ * @param other_matrix Square matrix, elements outside the band are ignored
+ * @param lower Count of subdiagonals
+ * @param upper Count of superdiagonals
+ */
+S21BandMatrix::S21BandMatrix(const S21Matrix& other_matrix, int lower, int upper) :
+    S21BandMatrix(other_matrix._rows, lower, upper) {
+    S21_MATRIX_CHECK(other_matrix._rows == other_matrix._cols, std::logic_error, "\nMatrix is not square\n");
+    const int width = _lower + _upper + 1;
+    for (int i = 0; i < _size; i++) {
+        for (int j = std::max(0, i - _lower); j <= std::min(_size - 1, i + _upper); j++) {
+            _values[static_cast<size_t>(i) * width + (j - i + _lower)] = other_matrix._matrix[i][j];
+        }
+    }
+}
+
+/**
+ * @brief Get count of matrix rows and columns
+ * 
+ * @return Int matrix size
+ */
+int S21BandMatrix::GetSize() const {
+    return _size;
+}
+
+/**
+ * @brief Get count of subdiagonals
+ * 
+ * @return Int lower bandwidth
+ */
+int S21BandMatrix::GetLower() const {
+    return _lower;
+}
+
+/**
+ * @brief Get count of superdiagonals
+ * 
+ * @return Int upper bandwidth
+ */
+int S21BandMatrix::GetUpper() const {
+    return _upper;
+}
+
+/**
+ * @brief Operator parentheses overload, only the band is accessible
+ * 
+ * @param rows Rows value
+ * @param cols Columns value
+ * @return Double& matrix value
+ */
+double& S21BandMatrix::operator()(int rows, int cols) {
+    S21_MATRIX_CHECK(rows >= 0 && rows < _size && cols >= 0 && cols < _size
+                     && cols - rows <= _upper && rows - cols <= _lower,
+                     std::logic_error, "\nIndex out of range\n");
+    return _values[static_cast<size_t>(rows) * (_lower + _upper + 1) + (cols - rows + _lower)];
+}
+
+/**
+ * @brief Operator parentheses overload for reading, elements outside the band read as zero
+ * 
+ * @param rows Rows value
+ * @param cols Columns value
+ * @return Double matrix value
+ */
+double S21BandMatrix::operator()(int rows, int cols) const {
+    S21_MATRIX_CHECK(rows >= 0 && rows < _size && cols >= 0 && cols < _size,
+                     std::logic_error, "\nIndex out of range\n");
+    if (cols - rows > _upper || rows - cols > _lower) {
+        return 0.0;
+    }
+    return _values[static_cast<size_t>(rows) * (_lower + _upper + 1) + (cols - rows + _lower)];
+}
+
+/**
+ * @brief Converts to a dense matrix
+ * 
+ * @return S21Matrix result matrix
+ */
+S21Matrix S21BandMatrix::to_matrix() const {
+    S21Matrix resultMatrix(_size, _size);
+    const int width = _lower + _upper + 1;
+    for (int i = 0; i < _size; i++) {
+        for (int j = std::max(0, i - _lower); j <= std::min(_size - 1, i + _upper); j++) {
+            resultMatrix._matrix[i][j] = _values[static_cast<size_t>(i) * width + (j - i + _lower)];
+        }
+    }
+    return resultMatrix;
+}
+
+/**
+ * @brief Multiplies the band matrix by a dense matrix
+ * 
+ * @param other_matrix Right operand
+ * @return S21Matrix result matrix
+ */
+S21Matrix S21BandMatrix::mul_matrix(const S21Matrix& other_matrix) const {
+    S21_MATRIX_CHECK(other_matrix._rows == _size, std::logic_error, "\nWrong count of rows or columns\n");
+    const int m = other_matrix._cols;
+    const int width = _lower + _upper + 1;
+    S21Matrix resultMatrix(_size, m);
+    for (int i = 0; i < _size; i++) {
+        double* resultRow = resultMatrix._matrix[i];
+        for (int k = std::max(0, i - _lower); k <= std::min(_size - 1, i + _upper); k++) {
+            const double factor = _values[static_cast<size_t>(i) * width + (k - i + _lower)];
+            const double* otherRow = other_matrix._matrix[k];
+            for (int j = 0; j < m; j++) {
+                resultRow[j] += factor * otherRow[j];
+            }
+        }
+    }
+    return resultMatrix;
+}
+
+/**
+ * @brief Band LU factorization with partial pivoting
+ * 
+ * Rows of the factors keep lower + upper superdiagonals to hold the fill-in
+ * of the row swaps, so the work is O(n * lower * (lower + upper)).
+ * 
+ * @param lu Row-major band storage of width 2 * lower + upper + 1 for the factors
+ * @param pivots Row swapped with row k on step k
+ * @return True if the matrix is nonsingular
+ */
+bool S21BandMatrix::band_lu_factorize(std::vector<double>* lu, std::vector<int>* pivots) const {
+    const int width = _lower + _upper + 1;
+    const int luWidth = 2 * _lower + _upper + 1;
+    lu->assign(static_cast<size_t>(_size) * luWidth, 0.0);
+    pivots->assign(_size, 0);
+    for (int i = 0; i < _size; i++) {
+        std::copy(_values.begin() + static_cast<size_t>(i) * width,
+                  _values.begin() + static_cast<size_t>(i + 1) * width,
+                  lu->begin() + static_cast<size_t>(i) * luWidth);
+    }
+    auto at = [&](int rows, int cols) -> double& {
+        return (*lu)[static_cast<size_t>(rows) * luWidth + (cols - rows + _lower)];
+    };
+    for (int k = 0; k < _size; k++) {
+        const int lastRow = std::min(_size - 1, k + _lower);
+        const int lastCol = std::min(_size - 1, k + _lower + _upper);
+        int pivot = k;
+        for (int i = k + 1; i <= lastRow; i++) {
+            if (std::fabs(at(i, k)) > std::fabs(at(pivot, k))) {
+                pivot = i;
+            }
+        }
+        (*pivots)[k] = pivot;
+        if (at(pivot, k) == 0.0) {
+            return false;
+        }
+        if (pivot != k) {
+            for (int j = k; j <= lastCol; j++) {
+                std::swap(at(k, j), at(pivot, j));
+            }
+        }
+        for (int i = k + 1; i <= lastRow; i++) {
+            const double factor = at(i, k) / at(k, k);
+            at(i, k) = factor;
+            for (int j = k + 1; j <= lastCol; j++) {
+                at(i, j) -= factor * at(k, j);
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Solves the system A * X = B by band LU factorization
+ * 
+ * @param other_matrix Right-hand side B
+ * @return S21Matrix solution X
+ */
+S21Matrix S21BandMatrix::solve(const S21Matrix& other_matrix) const {
+    S21_MATRIX_CHECK(other_matrix._rows == _size, std::logic_error, "\nWrong count of rows or columns\n");
+    std::vector<double> lu;
+    std::vector<int> pivots;
+    if (!band_lu_factorize(&lu, &pivots)) {
+        throw std::logic_error("\ndeterminant value can't be equal to 0\n");
+    }
+    const int luWidth = 2 * _lower + _upper + 1;
+    const int m = other_matrix._cols;
+    S21Matrix resultMatrix(other_matrix);
+    resultMatrix.detach_matrix();
+    for (int k = 0; k < _size; k++) {
+        std::swap(resultMatrix._matrix[k], resultMatrix._matrix[pivots[k]]);
+        const double* rowK = resultMatrix._matrix[k];
+        for (int i = k + 1; i <= std::min(_size - 1, k + _lower); i++) {
+            const double factor = lu[static_cast<size_t>(i) * luWidth + (k - i + _lower)];
+            double* rowI = resultMatrix._matrix[i];
+            for (int j = 0; j < m; j++) {
+                rowI[j] -= factor * rowK[j];
+            }
+        }
+    }
+    for (int i = _size - 1; i >= 0; i--) {
+        const double* row = lu.data() + static_cast<size_t>(i) * luWidth + _lower;
+        double* rowX = resultMatrix._matrix[i];
+        for (int k = i + 1; k <= std::min(_size - 1, i + _lower + _upper); k++) {
+            const double* rowK = resultMatrix._matrix[k];
+            for (int j = 0; j < m; j++) {
+                rowX[j] -= row[k - i] * rowK[j];
+            }
+        }
+        for (int j = 0; j < m; j++) {
+            rowX[j] /= row[0];
+        }
+    }
+    return resultMatrix;
+}
+
+/**
+ * @brief Finds the determinant by band LU factorization
+ * 
+ * @return Double determinant
+ */
+double S21BandMatrix::determinant() const {
+    std::vector<double> lu;
+    std::vector<int> pivots;
+    if (!band_lu_factorize(&lu, &pivots)) {
+        return 0.0;
+    }
+    const int luWidth = 2 * _lower + _upper + 1;
+    double result = 1.0;
+    for (int i = 0; i < _size; i++) {
+        const double diagonal = lu[static_cast<size_t>(i) * luWidth + _lower];
+        result *= pivots[i] == i ? diagonal : -diagonal;
+    }
+    return result;
+}
+
+/**
+ * @brief Construct a new S21MatrixGraph::S21MatrixGraph object
+ * 
+ */
+S21MatrixGraph::S21MatrixGraph() :
+    _maxBuffers(0),
+    _remaining(0),
+    _started(false) {
+}
+
+/**
+ * @brief Destroy the S21MatrixGraph::S21MatrixGraph object, waits for running tasks
+ * 
+ */
+S21MatrixGraph::~S21MatrixGraph() {
+    wait();
+}
+
+/**
+ * @brief Adds a matrix to the graph
+ * 
+ * @param matrix Matrix object, copied into the graph
+ * @return Node graph node of the matrix
+ */
+S21MatrixGraph::Node S21MatrixGraph::input(const S21Matrix& matrix) {
+    std::unique_ptr<Task> task(new Task);
+    task->value = std::make_unique<S21Matrix>(matrix);
+    return add_task(std::move(task));
+}
+
+/**
+ * @brief Adds a pending sum of two matrices
+ * 
+ * @param first First node
+ * @param second Second node
+ * @return Node graph node of the result
+ */
+S21MatrixGraph::Node S21MatrixGraph::sum_matrix(Node first, Node second) {
+    std::unique_ptr<Task> task(new Task);
+    task->inputs = {first, second};
+    task->inPlace = true;
+    task->operation = [](std::unique_ptr<S21Matrix>* value, const std::vector<S21Matrix*>& inputs) {
+        (*value)->sum_matrix(*inputs[1]);
+    };
+    return add_task(std::move(task));
+}
+
+/**
+ * @brief Adds a pending difference of two matrices
+ * 
+ * @param first First node
+ * @param second Second node
+ * @return Node graph node of the result
+ */
+S21MatrixGraph::Node S21MatrixGraph::sub_matrix(Node first, Node second) {
+    std::unique_ptr<Task> task(new Task);
+    task->inputs = {first, second};
+    task->inPlace = true;
+    task->operation = [](std::unique_ptr<S21Matrix>* value, const std::vector<S21Matrix*>& inputs) {
+        (*value)->sub_matrix(*inputs[1]);
+    };
+    return add_task(std::move(task));
+}
+
+/**
+ * @brief Adds a pending product of two matrices
+ * 
+ * @param first First node
+ * @param second Second node
+ * @return Node graph node of the result
+ */
+S21MatrixGraph::Node S21MatrixGraph::mul_matrix(Node first, Node second) {
+    std::unique_ptr<Task> task(new Task);
+    task->inputs = {first, second};
+    task->operation = [this](std::unique_ptr<S21Matrix>* value, const std::vector<S21Matrix*>& inputs) {
+        S21_MATRIX_CHECK(inputs[0]->_cols == inputs[1]->_rows, std::logic_error,
+                         "\nWrong count of rows or columns\n");
+        *value = acquire_buffer(inputs[0]->_rows, inputs[1]->_cols);
+        (*value)->mul_matrix_to(*inputs[0], *inputs[1]);
+    };
+    return add_task(std::move(task));
+}
+
+/**
+ * @brief Adds a pending product of a matrix and a number
+ * 
+ * @param node Matrix node
+ * @param num Number value
+ * @return Node graph node of the result
+ */
+S21MatrixGraph::Node S21MatrixGraph::mul_number(Node node, double num) {
+    std::unique_ptr<Task> task(new Task);
+    task->inputs = {node};
+    task->inPlace = true;
+    task->operation = [num](std::unique_ptr<S21Matrix>* value, const std::vector<S21Matrix*>&) {
+        (*value)->mul_number(num);
+    };
+    return add_task(std::move(task));
+}
+
+/**
+ * @brief Adds a pending matrix transpose
+ * 
+ * @param node Matrix node
+ * @return Node graph node of the result
+ */
+S21MatrixGraph::Node S21MatrixGraph::transpose(Node node) {
+    std::unique_ptr<Task> task(new Task);
+    task->inputs = {node};
+    task->operation = [](std::unique_ptr<S21Matrix>* value, const std::vector<S21Matrix*>& inputs) {
+        *value = std::make_unique<S21Matrix>(inputs[0]->transpose());
+    };
+    return add_task(std::move(task));
+}
+
+/**
+ * @brief Adds a pending matrix of algebraic complements
+ * 
+ * @param node Matrix node
+ * @return Node graph node of the result
+ */
+S21MatrixGraph::Node S21MatrixGraph::calc_complements(Node node) {
+    std::unique_ptr<Task> task(new Task);
+    task->inputs = {node};
+    task->operation = [](std::unique_ptr<S21Matrix>* value, const std::vector<S21Matrix*>& inputs) {
+        *value = std::make_unique<S21Matrix>(inputs[0]->calc_complements());
+    };
+    return add_task(std::move(task));
+}
+
+/**
+ * @brief Adds a pending inverse matrix
+ * 
+ * @param node Matrix node
+ * @return Node graph node of the result
+ */
+S21MatrixGraph::Node S21MatrixGraph::inverse_matrix(Node node) {
+    std::unique_ptr<Task> task(new Task);
+    task->inputs = {node};
+    task->operation = [](std::unique_ptr<S21Matrix>* value, const std::vector<S21Matrix*>& inputs) {
+        *value = std::make_unique<S21Matrix>(inputs[0]->inverse_matrix());
+    };
+    return add_task(std::move(task));
+}
+
+/**
+ * @brief Adds a pending solution of the system A * X = B
+ * 
+ * @param first Node of A
+ * @param second Node of B
+ * @return Node graph node of the result
+ */
+S21MatrixGraph::Node S21MatrixGraph::solve(Node first, Node second) {
+    std::unique_ptr<Task> task(new Task);
+    task->inputs = {first, second};
+    task->operation = [](std::unique_ptr<S21Matrix>* value, const std::vector<S21Matrix*>& inputs) {
+        *value = std::make_unique<S21Matrix>(inputs[0]->solve(*inputs[1]));
+    };
+    return add_task(std::move(task));
+}
+
+/**
+ * @brief Adds a pending determinant
+ * 
+ * @param node Matrix node
+ * @return std::shared_future<double> determinant, ready when the graph computes it
+ */
+std::shared_future<double> S21MatrixGraph::determinant(Node node) {
+    std::unique_ptr<Task> task(new Task);
+    task->inputs = {node};
+    task->reduction = [](S21Matrix* value) {
+        return value->determinant();
+    };
+    std::shared_future<double> result(task->scalarPromise.get_future().share());
+    add_task(std::move(task));
+    return result;
+}
+
+/**
+ * @brief Requests the value of a node, must be called before run
+ * 
+ * @param node Graph node
+ * @return std::shared_future<S21Matrix> matrix, ready when the graph computes it
+ */
+std::shared_future<S21Matrix> S21MatrixGraph::get_future(Node node) {
+    if (_started) {
+        throw std::logic_error("\nGraph is already running\n");
+    }
+    Task& task = get_task(node);
+    if (!task.exported) {
+        task.exported = true;
+        task.future = task.promise.get_future().share();
+    }
+    return task.future;
+}
+
+/**
+ * @brief Starts executing the graph, independent nodes run concurrently
+ * 
+ * @param threads Count of worker threads, 0 for the hardware concurrency
+ */
+void S21MatrixGraph::run(unsigned int threads) {
+    if (_started) {
+        throw std::logic_error("\nGraph is already running\n");
+    }
+    _started = true;
+    _remaining = static_cast<int>(_tasks.size());
+    for (size_t node = 0; node < _tasks.size(); node++) {
+        if (_tasks[node]->pendingInputs == 0) {
+            _ready.push_back(static_cast<Node>(node));
+        }
+    }
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    threads = std::min(threads, static_cast<unsigned int>(_tasks.size()));
+    _maxBuffers = threads;
+    for (unsigned int i = 0; i < threads; i++) {
+        _workers.emplace_back(&S21MatrixGraph::worker, this);
+    }
+}
+
+/**
+ * @brief Waits until all nodes of the graph are computed
+ * 
+ */
+void S21MatrixGraph::wait() {
+    for (std::thread& worker : _workers) {
+        worker.join();
+    }
+    _workers.clear();
+}
+
+/**
+ * @brief Registers a task and links it with the nodes it depends on
+ * 
+ * @param task New task
+ * @return Node graph node of the task
+ */
+S21MatrixGraph::Node S21MatrixGraph::add_task(std::unique_ptr<Task> task) {
+    if (_started) {
+        throw std::logic_error("\nGraph is already running\n");
+    }
+    for (Node input : task->inputs) {
+        get_task(input);
+    }
+    const Node node = static_cast<Node>(_tasks.size());
+    for (Node input : task->inputs) {
+        _tasks[input]->consumers.push_back(node);
+        _tasks[input]->pendingConsumers++;
+    }
+    task->pendingInputs = static_cast<int>(task->inputs.size());
+    _tasks.push_back(std::move(task));
+    return node;
+}
+
+/**
+ * @brief Get the task of a graph node
+ * 
+ * @param node Graph node
+ * @return Task& task object
+ */
+S21MatrixGraph::Task& S21MatrixGraph::get_task(Node node) {
+    if (node < 0 || node >= static_cast<Node>(_tasks.size()) || _tasks[node]->reduction) {
+        throw std::logic_error("\nWrong graph node\n");
+    }
+    return *_tasks[node];
+}
+
+/**
+ * @brief Worker thread loop, takes ready nodes until the whole graph is computed
+ * 
+ */
+void S21MatrixGraph::worker() {
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (true) {
+        _condition.wait(lock, [this] { return !_ready.empty() || _remaining == 0; });
+        if (_ready.empty()) {
+            break;
+        }
+        const Node node = _ready.back();
+        _ready.pop_back();
+        Task* task = _tasks[node].get();
+        bool reuseInput = false;
+        if (task->inPlace) {
+            const Task& first = *_tasks[task->inputs[0]];
+            reuseInput = first.pendingConsumers == 1 && !first.exported;
+        }
+        lock.unlock();
+        execute(task, reuseInput);
+        publish(task);
+        lock.lock();
+        finish(node);
+    }
+}
+
+/**
+ * @brief Computes the value of a task whose inputs are ready
+ * 
+ * @param task Task object
+ * @param reuseInput Take the buffer of the first input instead of copying it
+ */
+void S21MatrixGraph::execute(Task* task, bool reuseInput) {
+    try {
+        std::vector<S21Matrix*> values;
+        for (Node input : task->inputs) {
+            if (_tasks[input]->error) {
+                std::rethrow_exception(_tasks[input]->error);
+            }
+            values.push_back(_tasks[input]->value.get());
+        }
+        if (task->inPlace) {
+            if (reuseInput) {
+                task->value = std::move(_tasks[task->inputs[0]]->value);
+            } else {
+                task->value = std::make_unique<S21Matrix>(*values[0]);
+            }
+        }
+        if (task->operation) {
+            task->operation(&task->value, values);
+        }
+        if (task->reduction) {
+            task->scalar = task->reduction(values[0]);
+        }
+    } catch (...) {
+        task->error = std::current_exception();
+        task->value.reset();
+    }
+}
+
+/**
+ * @brief Passes the computed value or error to the futures of a task
+ * 
+ * @param task Task object
+ */
+void S21MatrixGraph::publish(Task* task) {
+    if (task->reduction) {
+        if (task->error) {
+            task->scalarPromise.set_exception(task->error);
+        } else {
+            task->scalarPromise.set_value(task->scalar);
+        }
+    } else if (task->exported) {
+        try {
+            if (task->error) {
+                std::rethrow_exception(task->error);
+            } else if (task->pendingConsumers == 0) {
+                task->promise.set_value(std::move(*task->value));
+                task->value.reset();
+            } else {
+                task->promise.set_value(*task->value);
+            }
+        } catch (...) {
+            task->promise.set_exception(std::current_exception());
+        }
+    }
+}
+
+/**
+ * @brief Releases buffers nobody reads anymore and schedules the ready consumers
+ * 
+ * @param node Computed graph node
+ */
+void S21MatrixGraph::finish(Node node) {
+    Task& task = *_tasks[node];
+    if (task.pendingConsumers == 0) {
+        release_buffer(&task.value);
+    }
+    for (Node input : task.inputs) {
+        if (--_tasks[input]->pendingConsumers == 0) {
+            release_buffer(&_tasks[input]->value);
+        }
+    }
+    for (Node consumer : task.consumers) {
+        if (--_tasks[consumer]->pendingInputs == 0) {
+            _ready.push_back(consumer);
+        }
+    }
+    _remaining--;
+    _condition.notify_all();
+}
+
+/**
+ * @brief Takes a released buffer of the given size or allocates a new one
+ * 
+ * @param rows Count of rows
+ * @param cols Count of columns
+ * @return std::unique_ptr<S21Matrix> buffer with unspecified values
+ */
+std::unique_ptr<S21Matrix> S21MatrixGraph::acquire_buffer(int rows, int cols) {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        for (std::unique_ptr<S21Matrix>& buffer : _buffers) {
+            if (buffer->_rows == rows && buffer->_cols == cols) {
+                std::unique_ptr<S21Matrix> result(std::move(buffer));
+                buffer = std::move(_buffers.back());
+                _buffers.pop_back();
+                return result;
+            }
+        }
+    }
+    return std::make_unique<S21Matrix>(rows, cols);
+}
+
+/**
+ * @brief Keeps a value nobody reads anymore for reuse, called under the graph mutex
+ * 
+ * At most one buffer per worker thread is kept, the others are deleted.
+ * 
+ * @param value Released value
+ */
+void S21MatrixGraph::release_buffer(std::unique_ptr<S21Matrix>* value) {
+    if (*value && !(*value)->IsShared() && _buffers.size() < _maxBuffers) {
+        _buffers.push_back(std::move(*value));
+    }
+    value->reset();
+}
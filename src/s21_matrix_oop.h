@@ -2,55 +2,265 @@
 #define SRC_S21_MATRIX_OOP_H_
 
 #include <iostream>
+#include <atomic>
 #include <cmath>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#define S21_MATRIX_CHECKS_NONE 0
+#define S21_MATRIX_CHECKS_DEBUG 1
+#define S21_MATRIX_CHECKS_FULL 2
+
+// Precondition checks of matrix operations: FULL throws std::logic_error,
+// DEBUG asserts and NONE skips them. The library and its users must be
+// built with the same value.
+#ifndef S21_MATRIX_CHECKS
+#define S21_MATRIX_CHECKS S21_MATRIX_CHECKS_FULL
+#endif
+
+// Copy-on-write: copies share a reference-counted storage and the first
+// write through a copy gives it its own storage. The library and its
+// users must be built with the same value.
+#ifndef S21_MATRIX_COW
+#define S21_MATRIX_COW 0
+#endif
+
+// Operations that can only fail a precondition check are noexcept when the
+// checks don't throw and a write never copies a shared storage.
+#define S21_MATRIX_NOEXCEPT noexcept(S21_MATRIX_CHECKS != S21_MATRIX_CHECKS_FULL && !S21_MATRIX_COW)
 
 class S21Matrix {
+    friend class S21SymmetricMatrix;
+    friend class S21TriangularMatrix;
+    friend class S21BandMatrix;
+    friend class S21MatrixGraph;
+
  private:
     int _rows, _cols;
     double** _matrix;
+#if S21_MATRIX_COW
+    std::atomic<int>* _refs;
+    bool _unsharable;
+#endif
 
     S21Matrix get_matrix_minor(const S21Matrix& OtherMatrix, int rows, int cols);
     void init_matrix(int rows, int cols);
     void free_matrix();
-    bool valid_matrix(const S21Matrix& other_matrix);
-    bool compare_two_matrix(const S21Matrix& other_matrix);
-    bool is_matrix_square(const S21Matrix& other_matrix);
+    void detach_matrix();
+    void discard_shared_matrix();
+    void mark_unsharable();
+    bool valid_matrix(const S21Matrix& other_matrix) const;
+    bool compare_two_matrix(const S21Matrix& other_matrix) const;
+    bool is_matrix_square(const S21Matrix& other_matrix) const;
     void null_object_field();
+    std::vector<double> get_flat_matrix(const S21Matrix& other_matrix) const;
+    void set_flat_matrix(const std::vector<double>& values);
+    void mul_matrix_to(const S21Matrix& first_matrix, const S21Matrix& second_matrix);
 
  public:
     S21Matrix();
     S21Matrix(int rows, int cols);
     S21Matrix(const S21Matrix& other_matrix);
-    S21Matrix(S21Matrix&& other_matrix);
+    S21Matrix(S21Matrix&& other_matrix) noexcept;
     ~S21Matrix();
 
-    bool eq_matrix(const S21Matrix& other_matrix);
-    void sum_matrix(const S21Matrix& other_matrix);
-    void sub_matrix(const S21Matrix& other_matrix);
-    void mul_number(const double num);
+    bool eq_matrix(const S21Matrix& other_matrix) const;
+    void sum_matrix(const S21Matrix& other_matrix) S21_MATRIX_NOEXCEPT;
+    void sub_matrix(const S21Matrix& other_matrix) S21_MATRIX_NOEXCEPT;
+    void mul_number(const double num) S21_MATRIX_NOEXCEPT;
     void mul_matrix(const S21Matrix& other_matrix);
 
-    double determinant();
+    double determinant() const;
     S21Matrix calc_complements();
     S21Matrix inverse_matrix();
     S21Matrix transpose();
 
-    int GetRows();
-    int GetCols();
+    S21Matrix solve(const S21Matrix& other_matrix);
+    S21Matrix solve_mixed(const S21Matrix& other_matrix, double* residual = nullptr);
+
+    S21Matrix pow(int power);
+    S21Matrix expm();
+
+    void qr(S21Matrix* q, S21Matrix* r);
+    S21Matrix qr_q();
+    S21Matrix qr_r();
+    S21Matrix least_squares(const S21Matrix& other_matrix);
+
+    void read_text(std::istream& stream, char delimiter = ',');
+    void write_text(std::ostream& stream, char delimiter = ',');
+    void load_file(const std::string& path, char delimiter = ',');
+    void save_file(const std::string& path, char delimiter = ',');
+
+    int GetRows() const;
+    int GetCols() const;
+    bool IsShared() const noexcept;
+    void SetSharable() noexcept;
     void SetRows(int rows);
     void SetColumns(int cols);
 
-    void operator+=(const S21Matrix& other_matrix);
-    void operator-=(const S21Matrix& other_matrix);
+    void operator+=(const S21Matrix& other_matrix) S21_MATRIX_NOEXCEPT;
+    void operator-=(const S21Matrix& other_matrix) S21_MATRIX_NOEXCEPT;
     void operator*=(const S21Matrix& other_matrix);
-    void operator*=(double num);
-    void operator=(S21Matrix&& other_matrix);
-    bool operator==(const S21Matrix& other_matrix);
-    double& operator()(int rows, int cols);
+    void operator*=(double num) S21_MATRIX_NOEXCEPT;
+    void operator=(S21Matrix&& other_matrix) noexcept;
+    bool operator==(const S21Matrix& other_matrix) const;
+    double& operator()(int rows, int cols) S21_MATRIX_NOEXCEPT;
+    double operator()(int rows, int cols) const noexcept(S21_MATRIX_CHECKS != S21_MATRIX_CHECKS_FULL);
+
+    void swap(S21Matrix& other_matrix) noexcept;
+    double& at_unchecked(int rows, int cols) noexcept(!S21_MATRIX_COW) {
+#if S21_MATRIX_COW
+        mark_unsharable();
+#endif
+        return _matrix[rows][cols];
+    }
+    double at_unchecked(int rows, int cols) const noexcept { return _matrix[rows][cols]; }
 
     S21Matrix operator+(const S21Matrix& other_matrix);
     S21Matrix operator-(const S21Matrix& other_matrix);
     S21Matrix operator*(const S21Matrix& other_matrix);
     S21Matrix operator*(double num);
 };
+
+class S21TriangularMatrix {
+    friend class S21SymmetricMatrix;
+
+ private:
+    int _size;
+    bool _upper;
+    std::vector<double> _values;
+
+    size_t get_index(int rows, int cols) const;
+
+ public:
+    explicit S21TriangularMatrix(int size, bool upper = false);
+    S21TriangularMatrix(const S21Matrix& other_matrix, bool upper);
+
+    int GetSize() const;
+    bool IsUpper() const;
+    double& operator()(int rows, int cols);
+    double operator()(int rows, int cols) const;
+
+    S21Matrix to_matrix() const;
+    S21Matrix mul_matrix(const S21Matrix& other_matrix) const;
+    S21Matrix solve(const S21Matrix& other_matrix) const;
+    double determinant() const;
+};
+
+class S21SymmetricMatrix {
+ private:
+    int _size;
+    std::vector<double> _values;
+
+    size_t get_index(int rows, int cols) const;
+    bool cholesky_to(S21TriangularMatrix* factor) const;
+
+ public:
+    explicit S21SymmetricMatrix(int size);
+    explicit S21SymmetricMatrix(const S21Matrix& other_matrix);
+
+    int GetSize() const;
+    double& operator()(int rows, int cols);
+    double operator()(int rows, int cols) const;
+
+    S21Matrix to_matrix() const;
+    S21Matrix mul_matrix(const S21Matrix& other_matrix) const;
+    S21TriangularMatrix cholesky() const;
+    S21Matrix solve(const S21Matrix& other_matrix) const;
+    double determinant() const;
+};
+
+class S21BandMatrix {
+ private:
+    int _size, _lower, _upper;
+    std::vector<double> _values;
+
+    bool band_lu_factorize(std::vector<double>* lu, std::vector<int>* pivots) const;
+
+ public:
+    S21BandMatrix(int size, int lower, int upper);
+    S21BandMatrix(const S21Matrix& other_matrix, int lower, int upper);
+
+    int GetSize() const;
+    int GetLower() const;
+    int GetUpper() const;
+    double& operator()(int rows, int cols);
+    double operator()(int rows, int cols) const;
+
+    S21Matrix to_matrix() const;
+    S21Matrix mul_matrix(const S21Matrix& other_matrix) const;
+    S21Matrix solve(const S21Matrix& other_matrix) const;
+    double determinant() const;
+};
+
+class S21MatrixGraph {
+ public:
+    typedef int Node;
+
+ private:
+    struct Task {
+        std::vector<Node> inputs;
+        std::vector<Node> consumers;
+        int pendingInputs = 0;
+        int pendingConsumers = 0;
+        bool inPlace = false;
+        bool exported = false;
+        std::function<void(std::unique_ptr<S21Matrix>* value, const std::vector<S21Matrix*>& inputs)>
+            operation;
+        std::function<double(S21Matrix* value)> reduction;
+        std::unique_ptr<S21Matrix> value;
+        double scalar = 0.0;
+        std::exception_ptr error;
+        std::promise<S21Matrix> promise;
+        std::promise<double> scalarPromise;
+        std::shared_future<S21Matrix> future;
+    };
+
+    std::vector<std::unique_ptr<Task>> _tasks;
+    std::vector<Node> _ready;
+    std::vector<std::thread> _workers;
+    std::vector<std::unique_ptr<S21Matrix>> _buffers;
+    size_t _maxBuffers;
+    std::mutex _mutex;
+    std::condition_variable _condition;
+    int _remaining;
+    bool _started;
+
+    Node add_task(std::unique_ptr<Task> task);
+    Task& get_task(Node node);
+    void worker();
+    void execute(Task* task, bool reuseInput);
+    void publish(Task* task);
+    void finish(Node node);
+    std::unique_ptr<S21Matrix> acquire_buffer(int rows, int cols);
+    void release_buffer(std::unique_ptr<S21Matrix>* value);
+
+ public:
+    S21MatrixGraph();
+    ~S21MatrixGraph();
+    S21MatrixGraph(const S21MatrixGraph&) = delete;
+    S21MatrixGraph& operator=(const S21MatrixGraph&) = delete;
+
+    Node input(const S21Matrix& matrix);
+    Node sum_matrix(Node first, Node second);
+    Node sub_matrix(Node first, Node second);
+    Node mul_matrix(Node first, Node second);
+    Node mul_number(Node node, double num);
+    Node transpose(Node node);
+    Node calc_complements(Node node);
+    Node inverse_matrix(Node node);
+    Node solve(Node first, Node second);
+
+    std::shared_future<S21Matrix> get_future(Node node);
+    std::shared_future<double> determinant(Node node);
+
+    void run(unsigned int threads = 0);
+    void wait();
+};
 #endif  // SRC_S21_MATRIX_OOP_H_
@@ -1,4 +1,5 @@
 #include <gtest/gtest.h>
+#include <sstream>
 #include "s21_matrix_oop.h"
 
 TEST(Constructor, DefaultConstructor) {
@@ -104,11 +105,13 @@ TEST(SumMatrix, SumTest1) {
   EXPECT_EQ(firstMatrix(0, 1), 0.0);
 }
 
+#if S21_MATRIX_CHECKS == S21_MATRIX_CHECKS_FULL
 TEST(SumMatrix, SumTest2) {
   S21Matrix firstMatrix(3, 3);
   S21Matrix secondMatrix(3, 2);
   EXPECT_THROW(firstMatrix.sum_matrix(secondMatrix), std::invalid_argument);
 }
+#endif
 
 TEST(SubMatrix, SubTest1) {
   S21Matrix firstMatrix(3, 3);
@@ -118,11 +121,13 @@ TEST(SubMatrix, SubTest1) {
   EXPECT_EQ(firstMatrix(0, 1), 0.0);
 }
 
+#if S21_MATRIX_CHECKS == S21_MATRIX_CHECKS_FULL
 TEST(SubMatrix, SubTest2) {
   S21Matrix firstMatrix(3, 3);
   S21Matrix secondMatrix(3, 2);
   EXPECT_THROW(firstMatrix.sum_matrix(secondMatrix), std::logic_error);
 }
+#endif
 
 TEST(MulMatrix, MulTest1) {
   S21Matrix firstMatrix(3, 3);
@@ -133,11 +138,13 @@ TEST(MulMatrix, MulTest1) {
   EXPECT_EQ(firstMatrix.GetCols(), 3);
 }
 
+#if S21_MATRIX_CHECKS == S21_MATRIX_CHECKS_FULL
 TEST(MulMatrix, MulTest2) {
   S21Matrix firstMatrix(3, 3);
   S21Matrix secondMatrix(2, 3);
   EXPECT_THROW(firstMatrix.mul_matrix(secondMatrix), std::logic_error);
 }
+#endif
 
 TEST(MulMatrix, MulTest3) {
   S21Matrix firstMatrix(3, 3);
@@ -166,22 +173,61 @@ TEST(Determinant, DeterminantTest) {
   ASSERT_EQ(determinant, 0);
 }
 
+TEST(Determinant, DeterminantTest2) {
+  S21Matrix firstMatrix(3, 3);
+  firstMatrix(0, 1) = 2.0;
+  firstMatrix(0, 2) = 3.0;
+  firstMatrix(1, 0) = 4.0;
+  firstMatrix(1, 1) = 5.0;
+  firstMatrix(1, 2) = 6.0;
+  firstMatrix(2, 0) = 7.0;
+  firstMatrix(2, 1) = 8.0;
+  firstMatrix(2, 2) = 10.0;
+  EXPECT_NEAR(firstMatrix.determinant(), -5.0, 1e-12);
+  const int size = 20;
+  S21Matrix secondMatrix(size, size);
+  for (int i = 0; i < size; i++) {
+    secondMatrix(i, i) = 2.0;
+    secondMatrix(i, size - 1 - i) += 1.0;
+  }
+  S21MatrixGraph graph;
+  std::shared_future<double> determinantFuture = graph.determinant(graph.input(secondMatrix));
+  graph.run();
+  EXPECT_NEAR(determinantFuture.get(), std::pow(3.0, size / 2), 1e-6);
+}
+
 TEST(CalcComplements, ComplTest1) {
   S21Matrix firstMatrix(3, 3);
   S21Matrix secondMatrix(firstMatrix.calc_complements());
   EXPECT_EQ(secondMatrix(2, 2), 0.0);
 }
 
+#if S21_MATRIX_CHECKS == S21_MATRIX_CHECKS_FULL
 TEST(CalcComplements, ComplTest2) {
   S21Matrix firstMatrix(3, 2);
   EXPECT_THROW(firstMatrix.calc_complements(), std::logic_error);
 }
+#endif
 
 TEST(InverseMatrix, InverseTest) {
   S21Matrix firstMatrix(3, 3);
   EXPECT_THROW(S21Matrix secondMatrix(firstMatrix.inverse_matrix()), std::logic_error);
 }
 
+TEST(InverseMatrix, InverseTest3) {
+  S21Matrix firstMatrix(3, 3);
+  for (int i = 0; i < 3; i++) {
+    for (int j = 0; j < 3; j++) {
+      firstMatrix(i, j) = i * 3 + j + 1.0;
+    }
+  }
+  EXPECT_EQ(firstMatrix.determinant(), 0.0);
+  EXPECT_THROW(firstMatrix.inverse_matrix(), std::logic_error);
+  EXPECT_THROW(firstMatrix.solve(firstMatrix), std::logic_error);
+  EXPECT_THROW(firstMatrix.solve_mixed(firstMatrix), std::logic_error);
+  EXPECT_THROW(firstMatrix.pow(-2), std::logic_error);
+}
+
 TEST(Operator, Plus) {
   S21Matrix firstMatrix(2, 2);
   S21Matrix secondMatrix(2, 2);
@@ -253,3 +299,632 @@ TEST(Operator, Ravno) {
   EXPECT_EQ(secondMatrix.GetCols(), 2);
   EXPECT_EQ(secondMatrix(0, 0), 0.0);
 }
+
+TEST(Solve, SolveTest1) {
+  S21Matrix firstMatrix(3, 3);
+  S21Matrix secondMatrix(3, 1);
+  firstMatrix(0, 0) = 2.0;
+  firstMatrix(0, 1) = 1.0;
+  firstMatrix(1, 0) = 1.0;
+  firstMatrix(1, 1) = 3.0;
+  firstMatrix(1, 2) = 2.0;
+  firstMatrix(2, 0) = 1.0;
+  firstMatrix(2, 2) = 4.0;
+  secondMatrix(0, 0) = 4.0;
+  secondMatrix(1, 0) = 13.0;
+  secondMatrix(2, 0) = 13.0;
+  S21Matrix thirdMatrix(firstMatrix.solve(secondMatrix));
+  EXPECT_NEAR(thirdMatrix(0, 0), 1.0, 1e-12);
+  EXPECT_NEAR(thirdMatrix(1, 0), 2.0, 1e-12);
+  EXPECT_NEAR(thirdMatrix(2, 0), 3.0, 1e-12);
+}
+
+TEST(Solve, SolveTest2) {
+  S21Matrix firstMatrix(3, 3);
+  S21Matrix secondMatrix(3, 1);
+  EXPECT_THROW(firstMatrix.solve(secondMatrix), std::logic_error);
+#if S21_MATRIX_CHECKS == S21_MATRIX_CHECKS_FULL
+  S21Matrix thirdMatrix(3, 2);
+  EXPECT_THROW(thirdMatrix.solve(secondMatrix), std::logic_error);
+#endif
+}
+
+TEST(Solve, SolveMixedTest) {
+  const int size = 50;
+  S21Matrix firstMatrix(size, size);
+  S21Matrix secondMatrix(size, 2);
+  for (int i = 0; i < size; i++) {
+    for (int j = 0; j < size; j++) {
+      firstMatrix(i, j) = (i == j) ? size : 1.0 / (1 + i + j);
+    }
+    secondMatrix(i, 0) = i;
+    secondMatrix(i, 1) = 1.0 / (i + 1);
+  }
+  double residual = 1.0;
+  S21Matrix thirdMatrix(firstMatrix.solve_mixed(secondMatrix, &residual));
+  EXPECT_LT(residual, 1e-14);
+  EXPECT_TRUE(thirdMatrix == firstMatrix.solve(secondMatrix));
+}
+
+TEST(InverseMatrix, InverseTest2) {
+  S21Matrix firstMatrix(3, 3);
+  firstMatrix(0, 0) = 2.0;
+  firstMatrix(0, 1) = 5.0;
+  firstMatrix(0, 2) = 7.0;
+  firstMatrix(1, 0) = 6.0;
+  firstMatrix(1, 1) = 3.0;
+  firstMatrix(1, 2) = 4.0;
+  firstMatrix(2, 0) = 5.0;
+  firstMatrix(2, 1) = -2.0;
+  firstMatrix(2, 2) = -3.0;
+  S21Matrix secondMatrix(firstMatrix.inverse_matrix());
+  EXPECT_NEAR(secondMatrix(0, 0), 1.0, 1e-12);
+  EXPECT_NEAR(secondMatrix(0, 1), -1.0, 1e-12);
+  EXPECT_NEAR(secondMatrix(1, 0), -38.0, 1e-12);
+  EXPECT_NEAR(secondMatrix(1, 1), 41.0, 1e-12);
+  EXPECT_NEAR(secondMatrix(2, 2), 24.0, 1e-12);
+#if S21_MATRIX_CHECKS == S21_MATRIX_CHECKS_FULL
+  S21Matrix thirdMatrix(3, 2);
+  EXPECT_THROW(thirdMatrix.inverse_matrix(), std::logic_error);
+#endif
+}
+
+TEST(Solve, SolveMixedFallbackTest) {
+  const int size = 10;
+  S21Matrix firstMatrix(size, size);
+  S21Matrix secondMatrix(size, 1);
+  for (int i = 0; i < size; i++) {
+    for (int j = 0; j < size; j++) {
+      firstMatrix(i, j) = 1.0 / (1 + i + j);
+    }
+    secondMatrix(i, 0) = 1.0;
+  }
+  double residual = 1.0;
+  S21Matrix thirdMatrix(firstMatrix.solve_mixed(secondMatrix, &residual));
+  EXPECT_LT(residual, 1e-14);
+}
+
+TEST(Pow, PowTest1) {
+  S21Matrix firstMatrix(2, 2);
+  firstMatrix(0, 0) = 1.0;
+  firstMatrix(0, 1) = 1.0;
+  firstMatrix(1, 0) = 1.0;
+  S21Matrix secondMatrix(firstMatrix.pow(30));
+  EXPECT_EQ(secondMatrix(0, 0), 1346269.0);
+  EXPECT_EQ(secondMatrix(0, 1), 832040.0);
+  EXPECT_EQ(secondMatrix(1, 1), 514229.0);
+  S21Matrix thirdMatrix(firstMatrix.pow(0));
+  EXPECT_EQ(thirdMatrix(0, 0), 1.0);
+  EXPECT_EQ(thirdMatrix(0, 1), 0.0);
+}
+
+TEST(Pow, PowTest2) {
+  S21Matrix firstMatrix(3, 3);
+  firstMatrix(0, 0) = 2.0;
+  firstMatrix(0, 1) = 5.0;
+  firstMatrix(0, 2) = 7.0;
+  firstMatrix(1, 0) = 6.0;
+  firstMatrix(1, 1) = 3.0;
+  firstMatrix(1, 2) = 4.0;
+  firstMatrix(2, 0) = 5.0;
+  firstMatrix(2, 1) = -2.0;
+  firstMatrix(2, 2) = -3.0;
+  S21Matrix secondMatrix(firstMatrix * firstMatrix);
+  secondMatrix *= firstMatrix;
+  EXPECT_TRUE(secondMatrix == firstMatrix.pow(3));
+  S21Matrix thirdMatrix(firstMatrix.inverse_matrix());
+  EXPECT_TRUE(thirdMatrix * thirdMatrix == firstMatrix.pow(-2));
+#if S21_MATRIX_CHECKS == S21_MATRIX_CHECKS_FULL
+  S21Matrix fourthMatrix(3, 2);
+  EXPECT_THROW(fourthMatrix.pow(2), std::logic_error);
+#endif
+}
+
+TEST(Expm, ExpmTest) {
+  S21Matrix firstMatrix(2, 2);
+  firstMatrix(0, 0) = 1.0;
+  firstMatrix(1, 1) = -2.0;
+  S21Matrix secondMatrix(firstMatrix.expm());
+  EXPECT_NEAR(secondMatrix(0, 0), std::exp(1.0), 1e-12);
+  EXPECT_NEAR(secondMatrix(1, 1), std::exp(-2.0), 1e-12);
+  EXPECT_NEAR(secondMatrix(0, 1), 0.0, 1e-12);
+
+  S21Matrix thirdMatrix(2, 2);
+  thirdMatrix(0, 1) = 3.0;
+  thirdMatrix(1, 0) = -3.0;
+  S21Matrix fourthMatrix(thirdMatrix.expm());
+  EXPECT_NEAR(fourthMatrix(0, 0), std::cos(3.0), 1e-12);
+  EXPECT_NEAR(fourthMatrix(0, 1), std::sin(3.0), 1e-12);
+  EXPECT_NEAR(fourthMatrix(1, 0), -std::sin(3.0), 1e-12);
+}
+
+TEST(QrDecomposition, QrTest1) {
+  const int rows = 80;
+  const int cols = 45;
+  S21Matrix firstMatrix(rows, cols);
+  for (int i = 0; i < rows; i++) {
+    for (int j = 0; j < cols; j++) {
+      firstMatrix(i, j) = std::sin(i * cols + j + 1.0) + (i == j ? 2.0 : 0.0);
+    }
+  }
+  S21Matrix qMatrix;
+  S21Matrix rMatrix;
+  firstMatrix.qr(&qMatrix, &rMatrix);
+  EXPECT_TRUE(qMatrix == firstMatrix.qr_q());
+  EXPECT_TRUE(rMatrix == firstMatrix.qr_r());
+  EXPECT_EQ(qMatrix.GetRows(), rows);
+  EXPECT_EQ(qMatrix.GetCols(), cols);
+  EXPECT_EQ(rMatrix.GetRows(), cols);
+  EXPECT_EQ(rMatrix(cols - 1, 0), 0.0);
+  EXPECT_TRUE(qMatrix * rMatrix == firstMatrix);
+  for (int i = 0; i < cols; i++) {
+    for (int j = 0; j < cols; j++) {
+      double dot = 0.0;
+      for (int k = 0; k < rows; k++) {
+        dot += qMatrix(k, i) * qMatrix(k, j);
+      }
+      EXPECT_NEAR(dot, i == j ? 1.0 : 0.0, 1e-12);
+    }
+  }
+}
+
+#if S21_MATRIX_CHECKS == S21_MATRIX_CHECKS_FULL
+TEST(QrDecomposition, QrTest2) {
+  S21Matrix firstMatrix(2, 3);
+  EXPECT_THROW(firstMatrix.qr_q(), std::logic_error);
+  EXPECT_THROW(firstMatrix.qr_r(), std::logic_error);
+  EXPECT_THROW(firstMatrix.qr(&firstMatrix, nullptr), std::logic_error);
+}
+#endif
+
+TEST(QrDecomposition, QrTest3) {
+  S21Matrix firstMatrix(4, 2);
+  for (int i = 0; i < 4; i++) {
+    firstMatrix(i, 0) = 1.0;
+    firstMatrix(i, 1) = i * i;
+  }
+  S21Matrix secondMatrix(firstMatrix);
+  S21Matrix qMatrix;
+  firstMatrix.qr(&qMatrix, &firstMatrix);
+  EXPECT_EQ(qMatrix.GetRows(), 4);
+  EXPECT_EQ(qMatrix.GetCols(), 2);
+  EXPECT_TRUE(qMatrix == secondMatrix.qr_q());
+  EXPECT_TRUE(firstMatrix == secondMatrix.qr_r());
+  S21Matrix rMatrix;
+  S21Matrix thirdMatrix(secondMatrix);
+  thirdMatrix.qr(&thirdMatrix, &rMatrix);
+  EXPECT_TRUE(thirdMatrix == qMatrix);
+  EXPECT_TRUE(rMatrix == firstMatrix);
+}
+
+TEST(LeastSquares, LeastSquaresTest1) {
+  S21Matrix firstMatrix(4, 2);
+  S21Matrix secondMatrix(4, 1);
+  for (int i = 0; i < 4; i++) {
+    firstMatrix(i, 0) = 1.0;
+    firstMatrix(i, 1) = i;
+  }
+  secondMatrix(0, 0) = 6.0;
+  secondMatrix(1, 0) = 5.0;
+  secondMatrix(2, 0) = 7.0;
+  secondMatrix(3, 0) = 10.0;
+  S21Matrix thirdMatrix(firstMatrix.least_squares(secondMatrix));
+  EXPECT_NEAR(thirdMatrix(0, 0), 4.9, 1e-12);
+  EXPECT_NEAR(thirdMatrix(1, 0), 1.4, 1e-12);
+}
+
+TEST(LeastSquares, LeastSquaresTest2) {
+  S21Matrix firstMatrix(4, 2);
+#if S21_MATRIX_CHECKS == S21_MATRIX_CHECKS_FULL
+  S21Matrix secondMatrix(3, 1);
+  EXPECT_THROW(firstMatrix.least_squares(secondMatrix), std::logic_error);
+#endif
+  S21Matrix thirdMatrix(4, 1);
+  EXPECT_THROW(firstMatrix.least_squares(thirdMatrix), std::logic_error);
+}
+
+TEST(MatrixGraph, GraphTest1) {
+  S21Matrix firstMatrix(3, 3);
+  S21Matrix secondMatrix(3, 3);
+  for (int i = 0; i < 3; i++) {
+    for (int j = 0; j < 3; j++) {
+      firstMatrix(i, j) = i * 3 + j + (i == j ? 5.0 : 0.0);
+      secondMatrix(i, j) = (i + 1) * (j + 2) % 5;
+    }
+  }
+  S21MatrixGraph graph;
+  S21MatrixGraph::Node first = graph.input(firstMatrix);
+  S21MatrixGraph::Node second = graph.input(secondMatrix);
+  S21MatrixGraph::Node product = graph.mul_matrix(first, second);
+  S21MatrixGraph::Node sum = graph.sum_matrix(first, second);
+  S21MatrixGraph::Node difference = graph.sub_matrix(product, sum);
+  S21MatrixGraph::Node scaled = graph.mul_number(difference, 0.5);
+  S21MatrixGraph::Node inverse = graph.inverse_matrix(first);
+  std::shared_future<S21Matrix> productFuture = graph.get_future(product);
+  std::shared_future<S21Matrix> scaledFuture = graph.get_future(scaled);
+  std::shared_future<S21Matrix> inverseFuture = graph.get_future(inverse);
+  std::shared_future<double> determinantFuture = graph.determinant(scaled);
+  graph.run(4);
+
+  S21Matrix expectedMatrix((firstMatrix * secondMatrix - (firstMatrix + secondMatrix)) * 0.5);
+  S21Matrix scaledMatrix(scaledFuture.get());
+  S21Matrix productMatrix(productFuture.get());
+  S21Matrix inverseMatrix(inverseFuture.get());
+  EXPECT_TRUE(productMatrix == firstMatrix * secondMatrix);
+  EXPECT_TRUE(scaledMatrix == expectedMatrix);
+  EXPECT_TRUE(inverseMatrix == firstMatrix.inverse_matrix());
+  EXPECT_NEAR(determinantFuture.get(), expectedMatrix.determinant(), 1e-9);
+  graph.wait();
+  EXPECT_THROW(graph.input(firstMatrix), std::logic_error);
+  EXPECT_THROW(graph.run(), std::logic_error);
+}
+
+TEST(MatrixGraph, GraphTest2) {
+  S21MatrixGraph graph;
+  S21MatrixGraph::Node first = graph.input(S21Matrix(3, 3));
+#if S21_MATRIX_CHECKS == S21_MATRIX_CHECKS_FULL
+  S21MatrixGraph::Node second = graph.input(S21Matrix(2, 3));
+  S21MatrixGraph::Node product = graph.mul_matrix(first, second);
+#else
+  S21MatrixGraph::Node product = graph.inverse_matrix(first);
+#endif
+  S21MatrixGraph::Node scaled = graph.mul_number(product, 2.0);
+  S21MatrixGraph::Node sum = graph.sum_matrix(first, first);
+  std::shared_future<S21Matrix> scaledFuture = graph.get_future(scaled);
+  std::shared_future<S21Matrix> sumFuture = graph.get_future(sum);
+  EXPECT_THROW(graph.mul_matrix(first, 10), std::logic_error);
+  graph.run();
+  EXPECT_THROW(scaledFuture.get(), std::logic_error);
+  S21Matrix sumMatrix(sumFuture.get());
+  EXPECT_EQ(sumMatrix.GetRows(), 3);
+}
+
+TEST(TextIO, ReadTextTest1) {
+  std::istringstream stream("1, 2.5,-3\r\n4,5e-3 , 6\n\n");
+  S21Matrix firstMatrix;
+  firstMatrix.read_text(stream);
+  EXPECT_EQ(firstMatrix.GetRows(), 2);
+  EXPECT_EQ(firstMatrix.GetCols(), 3);
+  EXPECT_EQ(firstMatrix(0, 1), 2.5);
+  EXPECT_EQ(firstMatrix(0, 2), -3.0);
+  EXPECT_EQ(firstMatrix(1, 1), 0.005);
+
+  std::istringstream secondStream("1\t2  3\n4 5 6");
+  firstMatrix.read_text(secondStream, ' ');
+  EXPECT_EQ(firstMatrix.GetRows(), 2);
+  EXPECT_EQ(firstMatrix(1, 2), 6.0);
+}
+
+TEST(TextIO, ReadTextTest2) {
+  S21Matrix firstMatrix;
+  std::istringstream firstStream("1,2\n3\n");
+  EXPECT_THROW(firstMatrix.read_text(firstStream), std::logic_error);
+  std::istringstream secondStream("1,x\n");
+  EXPECT_THROW(firstMatrix.read_text(secondStream), std::logic_error);
+  std::istringstream thirdStream("1,2,\n");
+  EXPECT_THROW(firstMatrix.read_text(thirdStream), std::logic_error);
+  std::istringstream fourthStream("\n\n");
+  EXPECT_THROW(firstMatrix.read_text(fourthStream), std::logic_error);
+  EXPECT_THROW(firstMatrix.load_file("/nonexistent/matrix.csv"), std::logic_error);
+}
+
+TEST(TextIO, WriteTextTest) {
+  const int rows = 700;
+  const int cols = 9;
+  S21Matrix firstMatrix(rows, cols);
+  for (int i = 0; i < rows; i++) {
+    for (int j = 0; j < cols; j++) {
+      firstMatrix(i, j) = std::sin(i * cols + j) / 3.0;
+    }
+  }
+  std::stringstream stream;
+  firstMatrix.write_text(stream);
+  S21Matrix secondMatrix;
+  secondMatrix.read_text(stream);
+  EXPECT_EQ(secondMatrix.GetRows(), rows);
+  EXPECT_EQ(secondMatrix.GetCols(), cols);
+  for (int i = 0; i < rows; i++) {
+    for (int j = 0; j < cols; j++) {
+      EXPECT_EQ(firstMatrix(i, j), secondMatrix(i, j));
+    }
+  }
+}
+
+TEST(TextIO, WriteTextTabTest) {
+  S21Matrix firstMatrix(3, 4);
+  for (int i = 0; i < 3; i++) {
+    for (int j = 0; j < 4; j++) {
+      firstMatrix(i, j) = (i - j) / 7.0;
+    }
+  }
+  std::stringstream stream;
+  firstMatrix.write_text(stream, '\t');
+  S21Matrix secondMatrix;
+  secondMatrix.read_text(stream, '\t');
+  EXPECT_EQ(secondMatrix.GetRows(), 3);
+  EXPECT_EQ(secondMatrix.GetCols(), 4);
+  for (int i = 0; i < 3; i++) {
+    for (int j = 0; j < 4; j++) {
+      EXPECT_EQ(firstMatrix(i, j), secondMatrix(i, j));
+    }
+  }
+  std::istringstream secondStream("1\t 2\r\n3 \t4\n");
+  secondMatrix.read_text(secondStream, '\t');
+  EXPECT_EQ(secondMatrix(1, 1), 4.0);
+  std::istringstream thirdStream("1\t\t2\n");
+  EXPECT_THROW(secondMatrix.read_text(thirdStream, '\t'), std::logic_error);
+}
+
+TEST(Operator, MoveAssignment) {
+  S21Matrix firstMatrix(2, 3);
+  firstMatrix(1, 2) = 4.0;
+  S21Matrix secondMatrix(5, 5);
+  secondMatrix = std::move(firstMatrix);
+  EXPECT_EQ(secondMatrix.GetRows(), 2);
+  EXPECT_EQ(secondMatrix.GetCols(), 3);
+  EXPECT_EQ(secondMatrix(1, 2), 4.0);
+  EXPECT_TRUE(std::is_nothrow_move_constructible<S21Matrix>::value);
+  EXPECT_TRUE(noexcept(secondMatrix.swap(firstMatrix)));
+}
+
+TEST(Accessor, AtUnchecked) {
+  S21Matrix firstMatrix(2, 3);
+  S21Matrix secondMatrix(3, 2);
+  firstMatrix.at_unchecked(1, 2) = 7.0;
+  EXPECT_EQ(firstMatrix(1, 2), 7.0);
+  firstMatrix.swap(secondMatrix);
+  EXPECT_EQ(firstMatrix.GetRows(), 3);
+  EXPECT_EQ(secondMatrix.at_unchecked(1, 2), 7.0);
+  const S21Matrix& thirdMatrix = secondMatrix;
+  EXPECT_EQ(thirdMatrix.at_unchecked(1, 2), 7.0);
+}
+
+TEST(TriangularMatrix, TriangularTest) {
+  S21Matrix firstMatrix(3, 3);
+  for (int i = 0; i < 3; i++) {
+    for (int j = 0; j < 3; j++) {
+      firstMatrix(i, j) = i + j + 1.0;
+    }
+  }
+  S21TriangularMatrix lowerMatrix(firstMatrix, false);
+  S21TriangularMatrix upperMatrix(firstMatrix, true);
+  EXPECT_EQ(lowerMatrix(2, 0), 3.0);
+  EXPECT_EQ(upperMatrix(0, 2), 3.0);
+#if S21_MATRIX_CHECKS == S21_MATRIX_CHECKS_FULL
+  EXPECT_THROW(lowerMatrix(0, 2), std::logic_error);
+#endif
+  EXPECT_EQ(lowerMatrix.determinant(), 1.0 * 3.0 * 5.0);
+
+  S21Matrix secondMatrix(3, 2);
+  secondMatrix(0, 0) = 1.0;
+  secondMatrix(1, 1) = 2.0;
+  secondMatrix(2, 0) = 3.0;
+  S21Matrix lowerDense(lowerMatrix.to_matrix());
+  S21Matrix upperDense(upperMatrix.to_matrix());
+  EXPECT_EQ(lowerDense(0, 2), 0.0);
+  EXPECT_TRUE(lowerMatrix.mul_matrix(secondMatrix) == lowerDense * secondMatrix);
+  EXPECT_TRUE(upperMatrix.mul_matrix(secondMatrix) == upperDense * secondMatrix);
+  EXPECT_TRUE(lowerDense * lowerMatrix.solve(secondMatrix) == secondMatrix);
+  EXPECT_TRUE(upperDense * upperMatrix.solve(secondMatrix) == secondMatrix);
+  const S21TriangularMatrix& thirdMatrix = upperMatrix;
+  EXPECT_EQ(thirdMatrix(0, 2), 3.0);
+  EXPECT_EQ(thirdMatrix(2, 0), 0.0);
+  EXPECT_TRUE(thirdMatrix.IsUpper());
+  EXPECT_EQ(thirdMatrix.GetSize(), 3);
+  EXPECT_TRUE(thirdMatrix.to_matrix() == upperDense);
+}
+
+TEST(SymmetricMatrix, SymmetricTest1) {
+  const int size = 6;
+  S21SymmetricMatrix firstMatrix(size);
+  for (int i = 0; i < size; i++) {
+    for (int j = 0; j <= i; j++) {
+      firstMatrix(i, j) = (i == j) ? size + 1.0 : 1.0 / (i + j + 1);
+    }
+  }
+  EXPECT_EQ(firstMatrix(1, 4), firstMatrix(4, 1));
+  S21Matrix denseMatrix(firstMatrix.to_matrix());
+  S21Matrix secondMatrix(size, 2);
+  for (int i = 0; i < size; i++) {
+    secondMatrix(i, 0) = i;
+    secondMatrix(i, 1) = 1.0;
+  }
+  EXPECT_TRUE(firstMatrix.mul_matrix(secondMatrix) == denseMatrix * secondMatrix);
+  S21Matrix lowerMatrix(firstMatrix.cholesky().to_matrix());
+  S21Matrix upperMatrix(S21TriangularMatrix(lowerMatrix, false).to_matrix().transpose());
+  EXPECT_TRUE(lowerMatrix * upperMatrix == denseMatrix);
+  EXPECT_TRUE(denseMatrix * firstMatrix.solve(secondMatrix) == secondMatrix);
+  EXPECT_NEAR(firstMatrix.determinant(), denseMatrix.determinant(), 1e-6);
+}
+
+TEST(SymmetricMatrix, SymmetricTest2) {
+  S21Matrix firstMatrix(3, 3);
+  firstMatrix(0, 1) = firstMatrix(1, 0) = 2.0;
+  firstMatrix(1, 1) = 1.0;
+  firstMatrix(2, 2) = 3.0;
+  S21SymmetricMatrix secondMatrix(firstMatrix);
+  EXPECT_THROW(secondMatrix.cholesky(), std::logic_error);
+  EXPECT_NEAR(secondMatrix.determinant(), firstMatrix.determinant(), 1e-12);
+}
+
+TEST(SymmetricMatrix, SymmetricTest3) {
+  S21Matrix firstMatrix(3, 3);
+  for (int i = 0; i < 3; i++) {
+    firstMatrix(i, i) = 4.0;
+  }
+  firstMatrix(1, 0) = 1.0;
+  const S21SymmetricMatrix secondMatrix(firstMatrix);
+  EXPECT_EQ(secondMatrix.GetSize(), 3);
+  EXPECT_EQ(secondMatrix(0, 1), 1.0);
+  EXPECT_NEAR(secondMatrix.determinant(), 60.0, 1e-12);
+  EXPECT_EQ(secondMatrix.cholesky().GetSize(), 3);
+  S21Matrix thirdMatrix(secondMatrix.to_matrix());
+  EXPECT_TRUE(thirdMatrix * secondMatrix.solve(firstMatrix) == firstMatrix);
+  EXPECT_TRUE(secondMatrix.mul_matrix(firstMatrix) == thirdMatrix * firstMatrix);
+}
+
+TEST(BandMatrix, BandTest) {
+  const int size = 9;
+  S21BandMatrix firstMatrix(size, 2, 1);
+  for (int i = 0; i < size; i++) {
+    for (int j = std::max(0, i - 2); j <= std::min(size - 1, i + 1); j++) {
+      firstMatrix(i, j) = std::sin(i * size + j + 1.0);
+    }
+  }
+#if S21_MATRIX_CHECKS == S21_MATRIX_CHECKS_FULL
+  EXPECT_THROW(firstMatrix(0, 2), std::logic_error);
+#endif
+  S21Matrix denseMatrix(firstMatrix.to_matrix());
+  S21BandMatrix secondMatrix(denseMatrix, 2, 1);
+  EXPECT_TRUE(secondMatrix.to_matrix() == denseMatrix);
+  S21Matrix thirdMatrix(size, 3);
+  for (int i = 0; i < size; i++) {
+    for (int j = 0; j < 3; j++) {
+      thirdMatrix(i, j) = i - j;
+    }
+  }
+  EXPECT_TRUE(firstMatrix.mul_matrix(thirdMatrix) == denseMatrix * thirdMatrix);
+  EXPECT_TRUE(denseMatrix * firstMatrix.solve(thirdMatrix) == thirdMatrix);
+  EXPECT_NEAR(firstMatrix.determinant(), denseMatrix.determinant(), 1e-9);
+  S21BandMatrix fourthMatrix(size, 1, 1);
+  EXPECT_EQ(fourthMatrix.determinant(), 0.0);
+  EXPECT_THROW(fourthMatrix.solve(thirdMatrix), std::logic_error);
+  const S21BandMatrix& fifthMatrix = secondMatrix;
+  EXPECT_EQ(fifthMatrix(0, 2), 0.0);
+  EXPECT_EQ(fifthMatrix(3, 1), denseMatrix(3, 1));
+  EXPECT_EQ(fifthMatrix.GetLower(), 2);
+  EXPECT_EQ(fifthMatrix.GetUpper(), 1);
+  EXPECT_NEAR(fifthMatrix.determinant(), denseMatrix.determinant(), 1e-9);
+  EXPECT_TRUE(fifthMatrix.mul_matrix(thirdMatrix) == denseMatrix * thirdMatrix);
+}
+
+TEST(CopyOnWrite, CopyTest1) {
+  S21Matrix firstMatrix(3, 3);
+  firstMatrix(1, 1) = 5.0;
+  S21Matrix sourceMatrix(firstMatrix);
+  EXPECT_FALSE(firstMatrix.IsShared());
+  firstMatrix.SetSharable();
+  S21Matrix secondMatrix(firstMatrix);
+  EXPECT_EQ(firstMatrix.IsShared(), S21_MATRIX_COW != 0);
+  EXPECT_EQ(secondMatrix.IsShared(), S21_MATRIX_COW != 0);
+  const S21Matrix& thirdMatrix = secondMatrix;
+  EXPECT_EQ(thirdMatrix(1, 1), 5.0);
+  EXPECT_EQ(secondMatrix.IsShared(), S21_MATRIX_COW != 0);
+  secondMatrix(1, 1) = 7.0;
+  EXPECT_FALSE(firstMatrix.IsShared());
+  EXPECT_FALSE(secondMatrix.IsShared());
+  EXPECT_EQ(firstMatrix(1, 1), 5.0);
+  EXPECT_EQ(secondMatrix(1, 1), 7.0);
+}
+
+TEST(CopyOnWrite, CopyTest2) {
+  S21Matrix sourceMatrix(2, 2);
+  sourceMatrix(0, 0) = 1.0;
+  sourceMatrix(1, 1) = 2.0;
+  S21Matrix firstMatrix(sourceMatrix);
+  S21Matrix secondMatrix(firstMatrix);
+  S21Matrix thirdMatrix(firstMatrix);
+  secondMatrix.sum_matrix(firstMatrix);
+  thirdMatrix.mul_number(3.0);
+  S21Matrix fourthMatrix(firstMatrix);
+  fourthMatrix.SetRows(3);
+  S21Matrix fifthMatrix(firstMatrix);
+  fifthMatrix.at_unchecked(0, 1) = 4.0;
+  EXPECT_EQ(firstMatrix(0, 0), 1.0);
+  EXPECT_EQ(firstMatrix(0, 1), 0.0);
+  EXPECT_EQ(firstMatrix.GetRows(), 2);
+  EXPECT_EQ(secondMatrix(0, 0), 2.0);
+  EXPECT_EQ(thirdMatrix(1, 1), 6.0);
+  EXPECT_EQ(fourthMatrix(1, 1), 2.0);
+  EXPECT_EQ(fifthMatrix(0, 1), 4.0);
+  S21Matrix sixthMatrix(firstMatrix.pow(3));
+  EXPECT_EQ(sixthMatrix(1, 1), 8.0);
+  EXPECT_EQ(firstMatrix(1, 1), 2.0);
+}
+
+TEST(CopyOnWrite, CopyTest3) {
+  S21Matrix firstMatrix(2, 2);
+  S21Matrix secondMatrix(firstMatrix);
+  double& firstElement = firstMatrix(0, 0);
+  S21Matrix thirdMatrix(firstMatrix);
+  firstElement = 9.0;
+  double& secondElement = secondMatrix.at_unchecked(1, 1);
+  S21Matrix fourthMatrix(secondMatrix);
+  secondElement = 3.0;
+  const S21Matrix& thirdConst = thirdMatrix;
+  const S21Matrix& fourthConst = fourthMatrix;
+  EXPECT_EQ(thirdConst(0, 0), 0.0);
+  EXPECT_EQ(fourthConst(1, 1), 0.0);
+  EXPECT_EQ(firstMatrix(0, 0), 9.0);
+  EXPECT_EQ(secondMatrix(1, 1), 3.0);
+  EXPECT_FALSE(firstMatrix.IsShared());
+  EXPECT_FALSE(secondMatrix.IsShared());
+}
+
+TEST(CopyOnWrite, CopyTest4) {
+  S21Matrix sourceMatrix(3, 3);
+  for (int i = 0; i < 3; i++) {
+    sourceMatrix(i, i) = i + 1.0;
+  }
+  const S21Matrix firstMatrix(sourceMatrix);
+  const S21Matrix secondMatrix(firstMatrix);
+  EXPECT_EQ(secondMatrix.GetRows(), 3);
+  EXPECT_EQ(secondMatrix.GetCols(), 3);
+  EXPECT_TRUE(secondMatrix.eq_matrix(firstMatrix));
+  EXPECT_TRUE(secondMatrix == sourceMatrix);
+  EXPECT_DOUBLE_EQ(secondMatrix.determinant(), 6.0);
+  EXPECT_EQ(firstMatrix.IsShared(), S21_MATRIX_COW != 0);
+  EXPECT_EQ(secondMatrix.IsShared(), S21_MATRIX_COW != 0);
+}
+
+TEST(CopyOnWrite, CopyTest5) {
+  S21Matrix firstMatrix(2, 3);
+  for (int i = 0; i < 2; i++) {
+    for (int j = 0; j < 3; j++) {
+      firstMatrix(i, j) = i + j;
+    }
+  }
+  firstMatrix.SetSharable();
+  S21Matrix secondMatrix(firstMatrix);
+  S21Matrix thirdMatrix(firstMatrix);
+  EXPECT_EQ(firstMatrix.IsShared(), S21_MATRIX_COW != 0);
+  EXPECT_EQ(thirdMatrix.IsShared(), S21_MATRIX_COW != 0);
+  firstMatrix.SetRows(3);
+  double& element = firstMatrix(2, 2);
+  S21Matrix fourthMatrix(firstMatrix);
+  element = 1.0;
+  firstMatrix.mul_matrix(S21Matrix(3, 3));
+  S21Matrix fifthMatrix(firstMatrix);
+  EXPECT_EQ(fifthMatrix.IsShared(), S21_MATRIX_COW != 0);
+  const S21Matrix& secondConst = secondMatrix;
+  const S21Matrix& fourthConst = fourthMatrix;
+  EXPECT_EQ(secondConst(1, 2), 3.0);
+  EXPECT_EQ(fourthConst(2, 2), 0.0);
+}
+
+TEST(MatrixGraph, GraphTest3) {
+  S21Matrix firstMatrix(4, 4);
+  for (int i = 0; i < 4; i++) {
+    firstMatrix(i, i) = 2.0;
+    firstMatrix(i, 3 - i) += 1.0;
+  }
+  S21MatrixGraph graph;
+  S21MatrixGraph::Node node = graph.input(firstMatrix);
+  for (int i = 0; i < 6; i++) {
+    node = graph.mul_matrix(node, graph.input(firstMatrix));
+  }
+  std::shared_future<S21Matrix> powerFuture = graph.get_future(node);
+  graph.run(2);
+  S21Matrix powerMatrix(powerFuture.get());
+  EXPECT_TRUE(powerMatrix == firstMatrix.pow(7));
+}
+
+TEST(Accessor, NoexceptPolicy) {
+  S21Matrix firstMatrix(2, 2);
+  const S21Matrix& secondMatrix = firstMatrix;
+  const bool unchecked = S21_MATRIX_CHECKS != S21_MATRIX_CHECKS_FULL;
+  EXPECT_EQ(noexcept(secondMatrix(0, 0)), unchecked);
+  EXPECT_EQ(noexcept(firstMatrix(0, 0)), unchecked && !S21_MATRIX_COW);
+  EXPECT_EQ(noexcept(firstMatrix.sum_matrix(secondMatrix)), unchecked && !S21_MATRIX_COW);
+  EXPECT_EQ(noexcept(firstMatrix.mul_number(2.0)), unchecked && !S21_MATRIX_COW);
+}